@@ -0,0 +1,81 @@
+#include "Arena.h" // Include Arena header file.
+
+#include <cstddef> // Include for size_t.
+    using std::size_t; // Use size_t from the standard namespace.
+
+#include <cstdint> // Include for uintptr_t.
+    using std::uintptr_t; // Use uintptr_t from the standard namespace.
+
+#include <new> // Include for operator new and bad_alloc.
+
+// Constructor: Records the block size; no memory is taken yet.
+Arena::Arena(size_t block_size) : blockSize{block_size} {}
+
+// Destructor: Frees every block.
+Arena::~Arena() {
+    this->free_blocks();
+}
+
+// Method: Allocates a block big enough for min_bytes and makes it current.
+void Arena::add_block(size_t min_bytes) {
+    size_t size = min_bytes > this->blockSize ? min_bytes : this->blockSize;
+    Block* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+    block->next = this->blocks;
+    block->size = size;
+    this->blocks = block;
+    this->cursor = reinterpret_cast<char*>(block + 1);
+    this->limit = this->cursor + size;
+}
+
+// Method: Frees every block.
+void Arena::free_blocks() {
+    while(this->blocks != nullptr) {
+        Block* next = this->blocks->next;
+        ::operator delete(this->blocks);
+        this->blocks = next;
+    }
+    this->cursor = nullptr;
+    this->limit = nullptr;
+}
+
+// Method: Bumps the cursor past aligned storage, starting a new block when this one is full.
+void* Arena::allocate(size_t bytes, size_t alignment) {
+    uintptr_t address = (reinterpret_cast<uintptr_t>(this->cursor) + alignment - 1) & ~(alignment - 1);
+    if(this->cursor == nullptr || address + bytes > reinterpret_cast<uintptr_t>(this->limit)) {
+        this->add_block(bytes + alignment);
+        address = (reinterpret_cast<uintptr_t>(this->cursor) + alignment - 1) & ~(alignment - 1);
+    }
+    char* storage = reinterpret_cast<char*>(address);
+    this->used += static_cast<size_t>(storage + bytes - this->cursor);
+    this->cursor = storage + bytes;
+    return storage;
+}
+
+// Method: Rewinds to the start of the storage in O(1).
+// If the last game overflowed into extra blocks, they are replaced by one block
+// that holds them all, so later games of the same size never overflow again.
+void Arena::reset() {
+    if(this->blocks != nullptr && this->blocks->next != nullptr) {
+        size_t total = this->capacity();
+        this->free_blocks();
+        this->blockSize = total;
+        this->add_block(total);
+    } else if(this->blocks != nullptr) {
+        this->cursor = reinterpret_cast<char*>(this->blocks + 1);
+        this->limit = this->cursor + this->blocks->size;
+    }
+    this->used = 0;
+}
+
+// Getter: Returns the bytes handed out since the last reset.
+size_t Arena::bytesUsed() const {
+    return this->used;
+}
+
+// Getter: Returns the bytes held across all blocks.
+size_t Arena::capacity() const {
+    size_t total = 0;
+    for(Block* block = this->blocks; block != nullptr; block = block->next)
+        total += block->size;
+    return total;
+}
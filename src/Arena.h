@@ -0,0 +1,66 @@
+#ifndef ARENA_H // Include guard to prevent multiple inclusions.
+#define ARENA_H
+
+#include <cstddef> // Include for size_t.
+    using std::size_t; // Use size_t from the standard namespace.
+
+#include <new> // Include for placement new.
+
+#include <utility> // Include for std::forward.
+
+// Declaration of the Arena class, a bump allocator for the objects of one game.
+// Players, grids, grid spaces, ships, studs and Camdens of a game are carved out of
+// one block in allocation order, which keeps a grid's spaces next to each other and
+// a ship next to its studs. Objects are still destroyed one by one (their vectors own
+// heap memory), but their storage is never freed individually: reset() hands the
+// whole block back in O(1) for the next game.
+class Arena {
+    private:
+        struct Block {
+            Block* next; // Older block, or nullptr.
+            size_t size; // Usable bytes after the header.
+        };
+
+        Block* blocks {nullptr}; // Newest block first.
+        char* cursor {nullptr}; // Next free byte of the newest block.
+        char* limit {nullptr}; // End of the newest block.
+        size_t blockSize; // Size of a fresh block.
+        size_t used {0}; // Bytes handed out since the last reset, padding included.
+
+        void add_block(size_t min_bytes); // Starts a new block of at least min_bytes.
+        void free_blocks(); // Returns every block to the system.
+
+    public:
+        // Constructor and Destructor.
+        explicit Arena(size_t block_size = 64 * 1024); // The first block is allocated on first use.
+        ~Arena(); // Frees every block; objects must already be destroyed.
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        // Methods to allocate and recycle storage.
+        void* allocate(size_t bytes, size_t alignment); // Carves aligned storage out of the current block.
+        void reset(); // Makes all storage reusable; merges overflow blocks into one so the next game fits.
+
+        // Getter methods.
+        size_t bytesUsed() const; // Bytes handed out since the last reset.
+        size_t capacity() const; // Bytes held across all blocks.
+
+        // Creates a T in the arena, or with plain new when there is no arena.
+        template <typename T, typename... Args>
+        static T* make(Arena* arena, Args&&... args) {
+            if(arena == nullptr)
+                return new T(std::forward<Args>(args)...);
+            return new (arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        // Destroys an object made by make with the same arena (nullptr objects are ignored).
+        template <typename T>
+        static void destroy(Arena* arena, T* object) {
+            if(arena == nullptr)
+                delete object;
+            else if(object != nullptr)
+                object->~T(); // Storage goes back with the next reset.
+        }
+};
+
+#endif // End of include guard.
@@ -3,6 +3,7 @@
 
 #include "Enums.h"       // Include Enums header file for enumerations.
 #include "Grid.h"        // Include Grid class for handling game grid.
+#include "Placements.h"  // Include the table of legal ship placements.
 #include "Stud.h"        // Include Stud class for ship parts.
 
 #include <string>        // Include string for handling text.
@@ -11,9 +12,6 @@
 #include <array>         // Include array for fixed-size arrays.
     using std::array;    // Use array from the standard namespace.
 
-#include <stdexcept>     // Include for handling exceptions like out_of_range.
-    using std::out_of_range; // Use out_of_range from the standard namespace.
-
 #include <iostream>      // Include for input-output operations.
     using std::cout;     // Use cout for console output.
     using std::endl;     // Use endl for line breaks.
@@ -40,7 +38,7 @@ Battleship::Battleship(Grid* on_grid, string start_space, char direction) : Ship
 // Destructor: Cleans up dynamically allocated Stud objects.
 Battleship::~Battleship() {
     for(size_t i = 0; i < 4; ++i) {
-        delete this->studs[i];    // Delete each stud to free memory.
+        Arena::destroy(this->arena, this->studs[i]);    // Delete each stud to free memory.
         this->studs[i] = nullptr; // Set pointer to nullptr to prevent dangling pointers.
     }
 }
@@ -69,34 +67,35 @@ bool Battleship::hasStud(Stud* stud) const {
 // Method: Initializes the studs array with new Stud objects.
 void Battleship::setStuds() {
     for(size_t i = 5, j = 0; i < 9; i++, j++) {
-        this->studs[j] = new Stud(Studs::studNames[i], this->ofPlayer, this); // Create new Stud.
-        this->intactStuds.push_back(this->studs[j]); // Add to intact studs list.
+        this->studs[j] = Arena::make<Stud>(this->arena, Studs::studNames[i], this->ofPlayer, this); // Create new Stud.
+        this->add_stud(this->studs[j]); // Add to intact studs list.
     }
 }
 
 // Method: Attempts to place the battleship on the grid.
-bool Battleship::placeOnGrid(string start_space, char direction, bool print_out) const {
-    vector<string> ship_spaces; // Vector to hold the spaces occupied by the ship.
-    try {
-        ship_spaces = Grid::getVector(start_space, direction, 3); // Get vector of spaces.
-    } catch (out_of_range& e) { // Catch out_of_range exceptions.
+bool Battleship::placeOnGrid(SpaceName start_space, char direction, bool print_out) const {
+    // Look up the Battleship's spaces and halo in the placement table (Battleship has a length of 4).
+    const Placement& placement = Placements::at(4, start_space, direction);
+    if(!placement.fits()) {
+        // Handle placements that would run off the grid.
         if(print_out)
-            cout << "Out of range." << endl; // Print error message.
-        return false; // Return false if placement failed.
+            cout << "Out of range." << endl;
+        return false; // Placement failed.
     }
-    if(this->onGrid->hasNoGoSpace(ship_spaces)) { // Check if any space is restricted.
+
+    // Check if any of the intended spaces are occupied by or adjacent to other ships.
+    if(!this->onGrid->canPlace(placement)) {
         if(print_out)
-            cout << "Ships cannot be touching." << endl; // Print warning message.
-        return false; // Return false if placement failed.
+            cout << "Ships cannot be touching." << endl;
+        return false; // Placement failed.
     }
-    // Place each stud on the grid.
-    for(size_t i = 0; i < 4; i++)
-        this->onGrid->setOnSpace(ship_spaces[i], this->studs[i]);
-    
-    // Add no-go spaces to prevent close placement of other ships.
-    vector<string> ship_neighbors = Grid::neighborSpaces(ship_spaces); // Get neighboring spaces.
-    this->onGrid->addNoGoSpaces(ship_spaces); // Mark occupied spaces as no-go.
-    this->onGrid->addNoGoSpaces(ship_neighbors); // Mark neighboring spaces as no-go.
+
+    // Place the Battleship's studs on the grid.
+    for(int i = 0; i < 4; i++)
+        this->onGrid->setOnSpace(placement.spaceAt(i), this->studs[i]);
+
+    // Mark the Battleship's spaces and their neighbors as no-go zones.
+    this->onGrid->addNoGoSpaces(placement.mask | placement.halo);
 
     return true; // Return true if placement was successful.
 }
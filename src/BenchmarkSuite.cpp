@@ -0,0 +1,229 @@
+#include "BenchmarkSuite.h"
+
+#include <string>
+    using std::string;
+    using std::getline;
+    using std::stod;
+
+#include <vector>
+    using std::vector;
+
+#include <algorithm>
+    using std::sort;
+
+#include <cmath>
+    using std::sqrt;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+    using std::chrono::duration;
+
+#include <fstream>
+    using std::ifstream;
+
+#include <sstream>
+    using std::istringstream;
+
+#include <iomanip>
+    using std::setw;
+    using std::left;
+    using std::right;
+    using std::fixed;
+    using std::setprecision;
+
+#include <ostream>
+    using std::ostream;
+    using std::endl;
+
+#include <stdexcept>
+    using std::runtime_error;
+
+// **Stopwatch**
+void Stopwatch::start() {
+    this->started = steady_clock::now();
+}
+
+void Stopwatch::stop() {
+    this->total += duration<double>(steady_clock::now() - this->started).count();
+}
+
+double Stopwatch::seconds() const {
+    return this->total;
+}
+
+// **BenchmarkResult: Throughput**
+double BenchmarkResult::opsPerSecond() const {
+    return this->medianNs > 0.0 ? 1e9 / this->medianNs : 0.0;
+}
+
+// **BenchmarkResult: Change Against the Baseline**
+double BenchmarkResult::changePercent() const {
+    return this->baselineNs > 0.0 ? (this->medianNs / this->baselineNs - 1.0) * 100.0 : 0.0;
+}
+
+// **BenchmarkResult: Verdict**
+string BenchmarkResult::status(double tolerance_percent) const {
+    if(this->baselineNs <= 0.0)
+        return "new";
+    double change = this->changePercent();
+    if(change > tolerance_percent)
+        return "slower";
+    if(change < -tolerance_percent)
+        return "faster";
+    return "ok";
+}
+
+// **Constructor**
+BenchmarkSuite::BenchmarkSuite(int num_reps, double tolerance_percent) : reps{num_reps > 0 ? num_reps : 1}, tolerance{tolerance_percent} {}
+
+// **Add a Case**
+void BenchmarkSuite::add(string name, long ops, function<void(long, Stopwatch&)> body) {
+    this->cases.push_back(Case{name, ops > 0 ? ops : 1, body});
+}
+
+// **Load a Baseline**
+// Reads the name and median_ns columns of a CSV from printCsv; other columns are ignored.
+void BenchmarkSuite::loadBaseline(string path) {
+    ifstream in(path);
+    if(!in)
+        throw runtime_error("Cannot read baseline " + path);
+    string line;
+    if(!getline(in, line))
+        throw runtime_error("Empty baseline " + path);
+    vector<string> header;
+    istringstream header_stream(line);
+    for(string column; getline(header_stream, column, ',');)
+        header.push_back(column);
+    int name_column = -1;
+    int median_column = -1;
+    for(size_t i = 0; i < header.size(); ++i) {
+        if(header[i] == "name") name_column = static_cast<int>(i);
+        if(header[i] == "median_ns") median_column = static_cast<int>(i);
+    }
+    if(name_column < 0 || median_column < 0)
+        throw runtime_error("Baseline " + path + " has no name and median_ns columns");
+    while(getline(in, line)) {
+        vector<string> fields;
+        istringstream line_stream(line);
+        for(string field; getline(line_stream, field, ',');)
+            fields.push_back(field);
+        if(static_cast<int>(fields.size()) <= median_column || static_cast<int>(fields.size()) <= name_column)
+            continue; // Blank or short line.
+        this->baseline[fields[name_column]] = stod(fields[median_column]);
+    }
+}
+
+// **Run Every Case**
+// Each case gets one untimed warm-up repetition, then reps timed ones.
+void BenchmarkSuite::run(ostream* progress) {
+    this->results.clear();
+    for(const Case& the_case : this->cases) {
+        if(progress != nullptr)
+            *progress << the_case.name << "..." << endl;
+        Stopwatch warm_up;
+        the_case.body(the_case.ops, warm_up);
+        BenchmarkResult result;
+        result.name = the_case.name;
+        result.ops = the_case.ops;
+        for(int rep = 0; rep < this->reps; ++rep) {
+            Stopwatch watch;
+            the_case.body(the_case.ops, watch);
+            result.nsPerOp.push_back(watch.seconds() * 1e9 / static_cast<double>(the_case.ops));
+        }
+        this->finish_result(result);
+        this->results.push_back(result);
+    }
+}
+
+// **Statistics**
+void BenchmarkSuite::finish_result(BenchmarkResult& result) const {
+    vector<double> sorted = result.nsPerOp;
+    sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+    result.minNs = sorted.front();
+    result.medianNs = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+    double sum = 0.0;
+    for(double ns : sorted)
+        sum += ns;
+    result.meanNs = sum / static_cast<double>(n);
+    double squares = 0.0;
+    for(double ns : sorted)
+        squares += (ns - result.meanNs) * (ns - result.meanNs);
+    result.stddevNs = n > 1 ? sqrt(squares / static_cast<double>(n - 1)) : 0.0;
+    auto found = this->baseline.find(result.name);
+    result.baselineNs = found == this->baseline.end() ? 0.0 : found->second;
+}
+
+// **Results**
+const vector<BenchmarkResult>& BenchmarkSuite::getResults() const {
+    return this->results;
+}
+
+// **Regression Check**
+bool BenchmarkSuite::hasRegression() const {
+    for(const BenchmarkResult& result : this->results)
+        if(result.status(this->tolerance) == "slower")
+            return true;
+    return false;
+}
+
+// **Text Report**
+void BenchmarkSuite::printText(ostream& out) const {
+    bool compare = !this->baseline.empty();
+    out << left << setw(34) << "case" << right << setw(12) << "median ns" << setw(12) << "min ns"
+        << setw(12) << "stddev ns" << setw(14) << "ops/sec";
+    if(compare)
+        out << setw(12) << "base ns" << setw(10) << "change" << "  status";
+    out << endl;
+    out << fixed;
+    for(const BenchmarkResult& result : this->results) {
+        out << left << setw(34) << result.name << right << setprecision(1)
+            << setw(12) << result.medianNs << setw(12) << result.minNs << setw(12) << result.stddevNs
+            << setprecision(0) << setw(14) << result.opsPerSecond();
+        if(compare) {
+            if(result.baselineNs > 0.0)
+                out << setprecision(1) << setw(12) << result.baselineNs << setw(9) << result.changePercent() << "%";
+            else
+                out << setw(12) << "-" << setw(10) << "-";
+            out << "  " << result.status(this->tolerance);
+        }
+        out << endl;
+    }
+    out.unsetf(std::ios::floatfield);
+    out << setprecision(6);
+}
+
+// **CSV Report**
+void BenchmarkSuite::printCsv(ostream& out) const {
+    out << "name,ops,reps,min_ns,median_ns,mean_ns,stddev_ns,ops_per_sec,baseline_ns,change_pct,status" << endl;
+    out << fixed << setprecision(3);
+    for(const BenchmarkResult& result : this->results) {
+        out << result.name << ',' << result.ops << ',' << result.nsPerOp.size() << ','
+            << result.minNs << ',' << result.medianNs << ',' << result.meanNs << ',' << result.stddevNs << ','
+            << result.opsPerSecond() << ',' << result.baselineNs << ',' << result.changePercent() << ','
+            << result.status(this->tolerance) << endl;
+    }
+    out.unsetf(std::ios::floatfield);
+    out << setprecision(6);
+}
+
+// **JSON Report**
+void BenchmarkSuite::printJson(ostream& out) const {
+    out << fixed << setprecision(3);
+    out << "{\n  \"reps\": " << this->reps << ",\n  \"tolerance_pct\": " << this->tolerance
+        << ",\n  \"regression\": " << (this->hasRegression() ? "true" : "false") << ",\n  \"results\": [";
+    for(size_t i = 0; i < this->results.size(); ++i) {
+        const BenchmarkResult& result = this->results[i];
+        out << (i ? "," : "") << "\n    {\"name\": \"" << result.name << "\", \"ops\": " << result.ops
+            << ", \"min_ns\": " << result.minNs << ", \"median_ns\": " << result.medianNs
+            << ", \"mean_ns\": " << result.meanNs << ", \"stddev_ns\": " << result.stddevNs
+            << ", \"ops_per_sec\": " << result.opsPerSecond() << ", \"ns_per_op\": [";
+        for(size_t j = 0; j < result.nsPerOp.size(); ++j)
+            out << (j ? ", " : "") << result.nsPerOp[j];
+        out << "], \"baseline_ns\": " << result.baselineNs << ", \"change_pct\": " << result.changePercent()
+            << ", \"status\": \"" << result.status(this->tolerance) << "\"}";
+    }
+    out << "\n  ]\n}" << endl;
+    out.unsetf(std::ios::floatfield);
+    out << setprecision(6);
+}
@@ -0,0 +1,99 @@
+#ifndef BENCHMARKSUITE_H
+#define BENCHMARKSUITE_H
+
+#include <string>
+    using std::string;
+
+#include <vector>
+    using std::vector;
+
+#include <map>
+    using std::map;
+
+#include <functional>
+    using std::function;
+
+#include <ostream>
+    using std::ostream;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+
+// **Stopwatch Class**
+// Adds up the time between start() and stop() calls, so a benchmark case can keep
+// its setup (dealing fleets, playing a game up to a position) out of the measurement.
+class Stopwatch {
+    private:
+        steady_clock::time_point started; // When the current lap began.
+        double total {0.0};               // Seconds measured so far.
+
+    public:
+        void start();           // Begins a lap.
+        void stop();            // Ends the lap and adds it to the total.
+        double seconds() const; // Total measured time.
+};
+
+// **BenchmarkResult Struct**
+// Per-operation timings of one case over every repetition.
+struct BenchmarkResult {
+    string name;                 // Case name, also the key in baseline files.
+    long ops {0};                // Operations per repetition.
+    vector<double> nsPerOp;      // Nanoseconds per operation, one entry per repetition.
+    double minNs {0.0};          // Fastest repetition.
+    double medianNs {0.0};       // Median repetition; the figure compared against baselines.
+    double meanNs {0.0};         // Mean over repetitions.
+    double stddevNs {0.0};       // Sample standard deviation over repetitions.
+    double baselineNs {0.0};     // Median from the baseline file, or 0 when the case is not in it.
+
+    double opsPerSecond() const;  // Throughput at the median.
+    double changePercent() const; // Median relative to the baseline, in percent (positive is slower).
+    string status(double tolerance_percent) const; // "new", "ok", "faster" or "slower".
+};
+
+// **BenchmarkSuite Class**
+// Runs named cases for a number of repetitions after one untimed warm-up, and reports
+// min/median/mean/stddev per operation as text, CSV or JSON. A CSV written by an
+// earlier run can be loaded as a baseline; a median more than the tolerance above the
+// baseline counts as a regression.
+class BenchmarkSuite {
+    private:
+        struct Case {
+            string name;                              // Case name.
+            long ops;                                 // Operations per repetition.
+            function<void(long, Stopwatch&)> body;    // Performs ops operations, timing them with the stopwatch.
+        };
+
+        vector<Case> cases;               // Cases in the order they were added.
+        vector<BenchmarkResult> results;  // Filled by run, in the same order.
+        map<string, double> baseline;     // Median nanoseconds per case from a baseline file.
+        int reps;                         // Timed repetitions per case.
+        double tolerance;                 // Allowed slowdown against the baseline, in percent.
+
+        void finish_result(BenchmarkResult& result) const; // Fills in the statistics and baseline of a result.
+
+    public:
+        // **Constructor**
+        explicit BenchmarkSuite(int num_reps = 7, double tolerance_percent = 10.0);
+
+        // **Setting Up**
+        void add(string name, long ops, function<void(long, Stopwatch&)> body); // Adds a case.
+        void loadBaseline(string path); // Reads medians from a CSV written by printCsv; throws if it cannot be read.
+
+        // **Running**
+        void run(ostream* progress = nullptr); // Times every case; names each case on progress as it starts.
+
+        // **Reporting**
+        const vector<BenchmarkResult>& getResults() const; // Results of the last run.
+        bool hasRegression() const;        // True if any case is slower than its baseline beyond the tolerance.
+        void printText(ostream& out) const; // Aligned table for people.
+        void printCsv(ostream& out) const;  // One row per case; the format loadBaseline reads.
+        void printJson(ostream& out) const; // One object with a result array.
+
+        // **Helpers for Cases**
+        template <typename T>
+        static void keep(const T& value) { // Stops the optimizer from dropping a result that is otherwise unused.
+            asm volatile("" : : "g"(&value) : "memory");
+        }
+};
+
+#endif
@@ -0,0 +1,27 @@
+#include "Bitboard.h" // Include Bitboard header file.
+
+#include "Enums.h" // Include for the SpaceName enumeration and space conversions.
+
+#include <string> // Include for using string class.
+    using std::string; // Use string from the standard namespace.
+
+#include <vector> // Include for using vector class.
+    using std::vector; // Use vector from the standard namespace.
+
+// Method: Builds a set from a vector of space strings (e.g. {"A1", "A2"}).
+Bitboard Bitboard::fromSpaceStrings(const vector<string>& space_strings) {
+    Bitboard board;
+    for(const string& space_string : space_strings)
+        board |= of(Spaces::nameFromString(space_string));
+    return board;
+}
+
+// Method: Lists the spaces in the set, from A1 to J10.
+vector<SpaceName> Bitboard::toSpaceNames() const {
+    vector<SpaceName> space_names;
+    space_names.reserve(static_cast<size_t>(this->count()));
+    Bitboard rest = *this;
+    while(rest.any())
+        space_names.push_back(static_cast<SpaceName>(rest.popLowest() + 1)); // Bit i is SpaceName i + 1.
+    return space_names;
+}
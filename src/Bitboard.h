@@ -0,0 +1,116 @@
+/* A Bitboard is a set of spaces on the 10x10 grid packed into 128 bits. Bit i stands
+for the space with SpaceName i + 1, so A1 is bit 0, J1 is bit 9 and J10 is bit 99.
+Occupancy, hits, misses and single ships can then be combined with plain bitwise
+operators instead of walking GridSpace objects. */
+
+#ifndef BITBOARD_H // Include guard to prevent multiple inclusions.
+#define BITBOARD_H
+
+#include <cstdint> // Include for fixed-width integer types.
+    using std::uint64_t; // Use uint64_t from the standard namespace.
+
+#include <vector> // Include for using vector class.
+    using std::vector; // Use vector from the standard namespace.
+
+#include <string> // Include for using string class.
+    using std::string; // Use string from the standard namespace.
+
+#include "Enums.h" // Include for the SpaceName enumeration.
+
+// Declaration of the Bitboard struct, a 100-bit set of grid spaces.
+struct Bitboard {
+    uint64_t lo {0}; // Bits 0 to 63 (A1 to D7).
+    uint64_t hi {0}; // Bits 64 to 99 (E7 to J10); the upper 28 bits always stay clear.
+
+    static constexpr uint64_t HIGH_BITS = (uint64_t(1) << 36) - 1; // Valid bits of the upper word.
+
+    // Constructors.
+    constexpr Bitboard() {} // Empty set.
+    constexpr Bitboard(uint64_t low, uint64_t high) : lo{low}, hi{high & HIGH_BITS} {} // Set from raw words.
+
+    // Static factory methods.
+    static constexpr Bitboard bit(int index) { // Set holding only the bit at index (0 to 99).
+        return index < 64 ? Bitboard(uint64_t(1) << index, 0) : Bitboard(0, uint64_t(1) << (index - 64));
+    }
+    static constexpr Bitboard of(SpaceName space_name) { // Set holding only the given space.
+        return bit(static_cast<int>(space_name) - 1);
+    }
+    static constexpr Bitboard full() { // Set holding all 100 spaces.
+        return Bitboard(~uint64_t(0), HIGH_BITS);
+    }
+    static constexpr Bitboard column(int column_index) { // Set holding one column (0 for A, 9 for J).
+        Bitboard board;
+        for (int row_index = 0; row_index < 10; ++row_index)
+            board |= bit(row_index * 10 + column_index);
+        return board;
+    }
+    static Bitboard fromSpaceStrings(const vector<string>& space_strings); // Set holding the given spaces.
+
+    // Single-bit access.
+    constexpr bool test(int index) const {
+        return index < 64 ? (this->lo >> index) & 1 : (this->hi >> (index - 64)) & 1;
+    }
+    constexpr bool has(SpaceName space_name) const { return this->test(static_cast<int>(space_name) - 1); }
+    constexpr void set(int index) { *this |= bit(index); }
+    constexpr void reset(int index) { *this &= ~bit(index); }
+
+    // Whole-set queries.
+    constexpr bool any() const { return (this->lo | this->hi) != 0; }
+    constexpr bool none() const { return !this->any(); }
+    constexpr bool intersects(Bitboard other) const { return (*this & other).any(); }
+    constexpr int count() const { return __builtin_popcountll(this->lo) + __builtin_popcountll(this->hi); }
+    constexpr int lowest() const { // Index of the lowest set bit, or -1 if the set is empty.
+        return this->lo ? __builtin_ctzll(this->lo) : (this->hi ? 64 + __builtin_ctzll(this->hi) : -1);
+    }
+    constexpr int popLowest() { // Clears and returns the lowest set bit, or -1 if the set is empty.
+        int index = this->lowest();
+        if (this->lo)
+            this->lo &= this->lo - 1;
+        else
+            this->hi &= this->hi - 1;
+        return index;
+    }
+    constexpr int select(int n) const { // Index of the n-th lowest set bit (n from 0), or -1 if there are not that many.
+        uint64_t word = this->lo;
+        int base = 0;
+        int low_count = __builtin_popcountll(this->lo);
+        if (n >= low_count) {
+            n -= low_count;
+            word = this->hi;
+            base = 64;
+        }
+        if (n >= __builtin_popcountll(word))
+            return -1;
+        while (n-- > 0)
+            word &= word - 1;
+        return base + __builtin_ctzll(word);
+    }
+    vector<SpaceName> toSpaceNames() const; // Lists the spaces in the set in grid order.
+    constexpr Bitboard spread() const { // Spaces orthogonally next to some space of the set, in it or not.
+        return (*this << 10) | (*this >> 10) | ((*this & ~column(9)) << 1) | ((*this & ~column(0)) >> 1);
+    }
+    constexpr Bitboard neighbors() const { return this->spread() & ~*this; } // Spaces orthogonally next to the set, not in it.
+
+    // Bitwise operators. Complement and shifts keep the set within the 100 valid bits.
+    constexpr Bitboard operator&(Bitboard other) const { return Bitboard(this->lo & other.lo, this->hi & other.hi); }
+    constexpr Bitboard operator|(Bitboard other) const { return Bitboard(this->lo | other.lo, this->hi | other.hi); }
+    constexpr Bitboard operator^(Bitboard other) const { return Bitboard(this->lo ^ other.lo, this->hi ^ other.hi); }
+    constexpr Bitboard operator~() const { return Bitboard(~this->lo, ~this->hi); }
+    constexpr Bitboard operator<<(int n) const {
+        if (n == 0) return *this;
+        if (n < 64) return Bitboard(this->lo << n, (this->hi << n) | (this->lo >> (64 - n)));
+        return Bitboard(0, this->lo << (n - 64));
+    }
+    constexpr Bitboard operator>>(int n) const {
+        if (n == 0) return *this;
+        if (n < 64) return Bitboard((this->lo >> n) | (this->hi << (64 - n)), this->hi >> n);
+        return Bitboard(this->hi >> (n - 64), 0);
+    }
+    constexpr Bitboard& operator&=(Bitboard other) { return *this = *this & other; }
+    constexpr Bitboard& operator|=(Bitboard other) { return *this = *this | other; }
+    constexpr Bitboard& operator^=(Bitboard other) { return *this = *this ^ other; }
+    constexpr bool operator==(Bitboard other) const { return this->lo == other.lo && this->hi == other.hi; }
+    constexpr bool operator!=(Bitboard other) const { return !(*this == other); }
+};
+
+#endif // End of include guard.
@@ -3,13 +3,16 @@
 #include "Enums.h"  // For enumerations like PlayerType and TargetResult.
 #include "Grid.h"   // To interact with the grid system of the game.
 #include "Player.h" // For managing player-specific operations.
+#include "Bitboard.h" // Hit, miss and ship masks of the foe grid.
+#include "View.h"   // Hands the afloat ship types to the heatmap without a vector.
 
 #include <string>
     using std::string;
 #include <vector>
     using std::vector;
+#include <array>
+    using std::array;
 #include <stdexcept>
-    using std::out_of_range;
     using std::logic_error;
 #include <iostream>
     using std::cout;
@@ -38,24 +41,17 @@ bool Camden::did_just_sink_ship() const {
 }
 
 // ** Validates Space Availability **
-// Confirms if a given space is in the list of attackable spaces.
+// Confirms if a given space is in the set of attackable spaces.
 // Returns `true` if the space can be targeted, otherwise `false`.
-bool Camden::space_is_available(string space) const {
-    for (const string& avail_space : this->availableSpaces) {
-        if (avail_space == space) {
-            return true;
-        }
-    }
-    return false;
+bool Camden::space_is_available(SpaceName space) const {
+    return this->availableSpaces.contains(space);
 }
 
 // ** Initializes Camden's State **
 // Populates the list of available spaces (all grid spaces) and
 // attack directions (`N`, `S`, `E`, `W`).
 void Camden::set_Camden() {
-    for (const string& space : Spaces::spaceStrings) {
-        this->availableSpaces.push_back(space);
-    }
+    this->availableSpaces = SpaceSet::all();
     for (char direction : this->directions) {
         this->attackDirections.push_back(direction);
     }
@@ -86,40 +82,23 @@ void Camden::switch_direction_to_opposite() {
 // Tracks the number of ships sunk by the opponent at the current turn.
 // This helps Camden decide whether a ship was just sunk.
 void Camden::update_num_ships_sank() {
-    int num_ships_sank = static_cast<int>(this->self->getFoe()->getSunkenShips().size());
+    int num_ships_sank = this->self->getFoe()->getNumSunkenShips();
     this->numShipsSank.push_back(num_ships_sank);
 }
 
 // ** Removes Isolated Spaces from Attack List **
 // Identifies spaces with no adjacent attackable neighbors and removes them.
 // These spaces are "holes" in the attack grid and are unlikely to contain ships.
+// A space has an available neighbor exactly when it lies in the spread of the set.
 void Camden::check_for_holes() {
-    vector<string> holes; // List of isolated spaces to be removed.
-    int good_neighbor_count; // Count of valid neighbors for each space.
-    for (const string& space : this->availableSpaces) {
-        good_neighbor_count = 0;
-        for (char direction : this->directions) {
-            try {
-                // Check the neighbor in the given direction.
-                string neighbor = Grid::goDirection(space, direction);
-                if (this->space_is_available(neighbor)) {
-                    ++good_neighbor_count;
-                }
-            } catch (out_of_range&) {
-                // Ignore out-of-bound neighbors.
-                continue;
-            }
-        }
-        if (good_neighbor_count == 0) {
-            holes.push_back(space); // Mark isolated spaces for removal.
-        }
-    }
+    Bitboard available = this->availableSpaces.mask();
+    Bitboard holes = available & ~available.spread(); // Isolated spaces to be removed.
     this->remove_available_spaces(holes); // Remove all isolated spaces.
 }
 
 // ** Starts Targeting a Ship **
 // Marks the start of an attack sequence on a specific ship.
-void Camden::initiate_attack(string space) {
+void Camden::initiate_attack(SpaceName space) {
     this->isAttackingShip = true; // Flag to indicate an ongoing attack.
     this->curVictimShip = this->foeGrid->getSpace(space)->getStud()->getOfShip(); // Set target ship.
     this->firstAttackSpace = space; // Record the first hit space.
@@ -140,35 +119,42 @@ void Camden::remove_attack_direction(char direction) {
 
 // ** Removes a Space from Available Spaces **
 // Deletes the specified space from Camden's list of targetable spaces.
-void Camden::remove_available_space(string space) {
-    for (size_t i = 0; i < this->availableSpaces.size(); ++i) {
-        if (this->availableSpaces[i] == space) {
-            this->availableSpaces.erase(this->availableSpaces.begin() + i);
-            break;
-        }
-    }
+void Camden::remove_available_space(SpaceName space) {
+    this->availableSpaces.remove(space);
 }
 
 // ** Removes Multiple Spaces from Available Spaces **
-// Calls `remove_available_space` for each space in the given list.
-void Camden::remove_available_spaces(vector<string> spaces) {
-    for (const string& space : spaces) {
-        this->remove_available_space(space);
-    }
+// Removes each space in the given list from the set of targets.
+void Camden::remove_available_spaces(const vector<SpaceName>& spaces) {
+    this->availableSpaces.remove(spaces);
+}
+
+// ** Removes a Mask of Spaces from Available Spaces **
+void Camden::remove_available_spaces(Bitboard spaces) {
+    this->availableSpaces.remove(spaces);
+}
+
+// ** Spaces of the Current Attack as a Mask **
+// Lets the neighbors of the attacked ship be found with shifts instead of a new list.
+Bitboard Camden::attack_mask() const {
+    Bitboard attack;
+    for (SpaceName space : this->attackSpaces)
+        attack |= Bitboard::of(space);
+    return attack;
 }
 
 // ** Resets Camden's Attack State **
 // Clears the current attack state and prepares Camden for the next attack sequence.
 // Updates available spaces and resets attack directions.
 void Camden::reset_to_default() {
-    this->firstAttackSpace = ""; // Clear first attack space.
-    this->lastAttackSpace = "";  // Clear last attack space.
+    this->firstAttackSpace = NO_SPACE; // Clear first attack space.
+    this->lastAttackSpace = NO_SPACE;  // Clear last attack space.
     this->attackDirection = ' '; // Reset attack direction.
     this->isAttackingShip = false; // No active ship being targeted.
     this->hasSunkShip = false;     // Reset sunk ship flag.
     this->curVictimShip = nullptr; // Clear current victim ship.
     this->remove_available_spaces(this->attackSpaces); // Remove used attack spaces.
-    this->remove_available_spaces(Grid::neighborSpaces(this->attackSpaces)); // Remove neighboring spaces.
+    this->remove_available_spaces(this->attack_mask().neighbors()); // Remove neighboring spaces.
     this->check_for_holes(); // Check for isolated spaces to remove.
     this->attackSpaces.clear(); // Clear attack history.
     this->attackDirections.clear(); // Reset attack directions.
@@ -186,31 +172,252 @@ void Camden::do_switch() {
 
 // ** Checks if a Space Contains a Ship's Stud **
 // Returns `true` if the space contains a ship part, otherwise `false`.
-bool Camden::is_a_hit(string space) const {
+bool Camden::is_a_hit(SpaceName space) const {
     return this->foeGrid->getSpace(space)->hasStud();
 }
 
 // ** Picks a Random Direction for Attack **
 // Chooses a new direction to attack, ensuring it is valid and within bounds.
-string Camden::pick_direction(int(*rand_func)(), char& direction) {
-    string new_space; // Holds the new attack space.
+SpaceName Camden::pick_direction(Random& rand_func, char& direction) {
+    SpaceName new_space = NO_SPACE; // Holds the new attack space.
     do {
         direction = this->attackDirections[static_cast<size_t>(rand_func() % this->attackDirections.size())];
-        try {
-            string& tentative_new_space = new_space;
-            tentative_new_space = Grid::goDirection(this->firstAttackSpace, direction); // Calculate the new space.
-            if (this->space_is_available(new_space)) {
-                break; // Valid space found.
-            } else {
-                this->remove_attack_direction(direction); // Remove invalid direction.
-            }
-        } catch (out_of_range&) {
-            this->remove_attack_direction(direction); // Handle out-of-bound directions.
-            continue;
+        new_space = Grid::stepDirection(this->firstAttackSpace, direction); // Calculate the new space.
+        if (new_space != NO_SPACE && this->space_is_available(new_space)) {
+            break; // Valid space found.
         }
+        this->remove_attack_direction(direction); // Remove invalid or out-of-bound direction.
     } while (this->attackDirections.size());
-    if (new_space.empty()) {
+    if (new_space == NO_SPACE) {
         throw logic_error("All directions exhausted."); // No valid directions remain.
     }
     return new_space;
 }
+
+// ** Picks the Next Space While Attacking a Ship **
+// With only the first hit known, probes a random direction around it.
+// Once a line is established, keeps going that way and reverses on a miss or at the edge.
+SpaceName Camden::pick_attack_space(Random& rand_func) {
+    SpaceName attack_space;
+    if (this->attackSpaces.size() == 1) {
+        char direction;
+        attack_space = this->pick_direction(rand_func, direction);
+        if (this->is_a_hit(attack_space)) {
+            this->attackDirection = direction; // The line runs this way.
+            this->lastAttackSpace = attack_space;
+            this->attackSpaces.push_back(attack_space);
+        } else {
+            this->remove_attack_direction(direction); // Nothing this way.
+        }
+    } else {
+        attack_space = Grid::stepDirection(this->lastAttackSpace, this->attackDirection);
+        if (attack_space == NO_SPACE) {
+            this->do_switch(); // Reached the edge, go back the other way.
+            attack_space = Grid::goDirection(this->lastAttackSpace, this->attackDirection); // The ship continues past the first hit.
+        }
+        if (this->is_a_hit(attack_space)) {
+            this->lastAttackSpace = attack_space;
+            this->attackSpaces.push_back(attack_space);
+        } else {
+            this->do_switch(); // End of the ship this way, go back the other way.
+        }
+    }
+    this->update_num_ships_sank();
+    if (this->did_just_sink_ship()) {
+        this->remove_available_spaces(this->attackSpaces);
+        this->remove_available_spaces(this->attack_mask().neighbors());
+        this->check_for_holes();
+        this->reset_to_default();
+    }
+    return attack_space;
+}
+
+// ** Picks a Random Space to Hunt **
+// Starts an attack sequence if the space holds a ship, otherwise drops it from the targets.
+SpaceName Camden::pick_random_space(Random& rand_func) {
+    SpaceName space = this->availableSpaces.at(static_cast<size_t>(rand_func()) % this->availableSpaces.size());
+    if (this->is_a_hit(space))
+        this->initiate_attack(space);
+    else
+        this->remove_available_space(space);
+    this->update_num_ships_sank();
+    return space;
+}
+
+// ** Picks Any Untried Space **
+// The RANDOM strategy: uniform over spaces not fired at yet, with no follow-up on hits.
+SpaceName Camden::pick_blind_space(Random& rand_func) {
+    SpaceName space = this->availableSpaces.at(static_cast<size_t>(rand_func()) % this->availableSpaces.size());
+    this->remove_available_space(space);
+    return space;
+}
+
+// ** Picks the Densest Space **
+// The HARD strategy: refreshes the heatmap from Camden's own shots and the sunk ships
+// (announced by the game, so their spaces and halo are known), then fires at the space
+// covered by the most legal placements of the ships still afloat. With a cache, an
+// early state some Camden has weighed before is not weighed again; the heatmap
+// catches up on the next state that misses.
+SpaceName Camden::pick_dense_space(Random& rand_func) {
+    RolloutSearch::Observation seen = this->read_foe();
+    View<ShipType> afloat(seen.afloat.data(), static_cast<size_t>(seen.numAfloat)); // The used part of the afloat types, without a copy.
+    bool cached = this->heatmapCache != nullptr && this->heatmapCache->admits(seen.targeted.count());
+    HeatmapCache* cache = cached ? this->heatmapCache : nullptr;
+    HeatmapKey key;
+    if (cache != nullptr) {
+        key.hits = seen.hits;
+        key.misses = seen.targeted & ~seen.hits;
+        key.sunk = seen.sunk;
+        for (ShipType ship_type : afloat)
+            key.afloat |= 1u << ship_type;
+        key.prior = this->heatmap.getPrior();
+    }
+    array<long, 100> weights;
+    if (cache == nullptr || !cache->find(key, weights)) {
+        this->heatmap.observe(seen.hits, (seen.targeted & ~seen.hits) | seen.sunk | seen.sunk.neighbors());
+        this->heatmap.weigh(afloat, seen.hits & ~seen.sunk, seen.targeted, weights);
+        if (cache != nullptr)
+            cache->insert(key, weights);
+    }
+    SpaceName space = Heatmap::pickBest(weights, seen.targeted, rand_func);
+    if (space == NO_SPACE)
+        return this->pick_blind_space(rand_func); // Nothing fits the observations; fall back to any untried space.
+    this->remove_available_space(space);
+    return space;
+}
+
+// ** Picks the Space Playouts Favour **
+// The ROLLOUT strategy: the same observations as HARD, handed to a playout search
+// that compares the heaviest spaces within the move's budget.
+SpaceName Camden::pick_rollout_space(Random& rand_func) {
+    RolloutSearch::Observation seen = this->observe_foe();
+    SpaceName space = RolloutSearch::bestMove(this->heatmap, seen, this->budget, rand_func);
+    if (space == NO_SPACE)
+        return this->pick_blind_space(rand_func); // Nothing fits the observations; fall back to any untried space.
+    this->remove_available_space(space);
+    return space;
+}
+
+// ** Reads the Foe Grid **
+// Collects the hits, the sunk ships (announced by the game, so their spaces and halo
+// are known), the ships still afloat and every space fired at.
+RolloutSearch::Observation Camden::read_foe() const {
+    RolloutSearch::Observation seen;
+    seen.hits = this->foeGrid->getHitMask();
+    for (ShipType ship_type : {CARRIER, BATTLESHIP, SUBMARINE, DESTROYER, CRUISER}) {
+        if (this->foeGrid->shipIsSunk(ship_type)) {
+            seen.sunkShips[ship_type] = this->foeGrid->getShipMask(ship_type);
+            seen.sunk |= seen.sunkShips[ship_type];
+        } else
+            seen.afloat[seen.numAfloat++] = ship_type;
+    }
+    seen.targeted = seen.hits | this->foeGrid->getMissMask();
+    return seen;
+}
+
+// ** Observes the Foe Grid **
+// Reads the foe grid and rules out the placements it forbids.
+RolloutSearch::Observation Camden::observe_foe() {
+    RolloutSearch::Observation seen = this->read_foe();
+    this->heatmap.observe(seen.hits, (seen.targeted & ~seen.hits) | seen.sunk | seen.sunk.neighbors());
+    return seen;
+}
+
+// ** Default Constructor **
+Camden::Camden() {}
+
+// ** Constructor **
+// Binds Camden to its player and the opponent's grid, then fills the target lists.
+Camden::Camden(Player* the_self) : self{the_self} {
+    this->foeGrid = this->self->getFoeGrid();
+    this->set_Camden();
+}
+
+// ** Constructor With Strategy **
+Camden::Camden(Player* the_self, CamdenType camden_type) : self{the_self}, type{camden_type} {
+    this->foeGrid = this->self->getFoeGrid();
+    this->set_Camden();
+}
+
+// ** Destructor **
+Camden::~Camden() {
+    this->self = nullptr;
+    this->foeGrid = nullptr;
+    this->curVictimShip = nullptr;
+}
+
+// ** Getter for Strategy **
+CamdenType Camden::getType() const {
+    return this->type;
+}
+
+// ** Setter for Prior **
+// Only the HARD and ROLLOUT strategies read it, through the heatmap.
+void Camden::setPrior(const PlacementPrior* prior) {
+    this->heatmap.setPrior(prior);
+}
+
+// ** Setter for Heatmap Cache **
+// Only the HARD strategy reads it. The cache may be shared by Camdens on other threads.
+void Camden::setHeatmapCache(HeatmapCache* heatmap_cache) {
+    this->heatmapCache = heatmap_cache;
+}
+
+// ** Setter for Search Budget **
+void Camden::setSearchBudget(const SearchBudget& search_budget) {
+    this->budget = search_budget;
+}
+
+// ** Chooses Camden's Next Space **
+// Keeps attacking the current ship if there is one, otherwise hunts at random.
+SpaceName Camden::makeAMove(Random& rand_func) {
+    if (this->type == RANDOM)
+        return this->pick_blind_space(rand_func);
+    if (this->type == HARD)
+        return this->pick_dense_space(rand_func);
+    if (this->type == ROLLOUT)
+        return this->pick_rollout_space(rand_func);
+    if (this->isAttackingShip)
+        return this->pick_attack_space(rand_func);
+    return this->pick_random_space(rand_func);
+}
+
+// ** Discards a Rejected Space **
+// Called when the game refused Camden's last choice (e.g. it was already targeted).
+void Camden::badBoy(SpaceName space) {
+    this->remove_available_space(space);
+}
+
+// ** Handles Camden's Move **
+// Discards the previously rejected space, if any, and picks a new one.
+SpaceName Camden::makeMove(Random& rand_func, SpaceName bad_space) {
+    if (bad_space != NO_SPACE)
+        this->badBoy(bad_space);
+    return this->makeAMove(rand_func);
+}
+
+// ** Handles Camden's Move Within a Budget **
+// The budget stays for later moves; only the ROLLOUT strategy spends it.
+SpaceName Camden::makeMove(Random& rand_func, const SearchBudget& search_budget, SpaceName bad_space) {
+    this->budget = search_budget;
+    return this->makeMove(rand_func, bad_space);
+}
+
+// ** Starts Over for a New Game **
+// Puts every list and flag back to how the constructor left them. The lists are
+// cleared rather than rebuilt, so their storage carries over to the next game.
+void Camden::reset() {
+    this->foeGrid = this->self->getFoeGrid();
+    this->curVictimShip = nullptr;
+    this->firstAttackSpace = NO_SPACE;
+    this->lastAttackSpace = NO_SPACE;
+    this->attackDirection = ' ';
+    this->isAttackingShip = false;
+    this->hasSunkShip = false;
+    this->lastAttackSpaceWasEmpty = false;
+    this->attackSpaces.clear();
+    this->attackDirections.clear();
+    this->numShipsSank.clear();
+    this->heatmap.reset();
+    this->set_Camden();
+}
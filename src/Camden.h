@@ -10,22 +10,31 @@
 #include "Grid.h"      // To access and manipulate the game grid.
 #include "Player.h"    // For interactions with the player class.
 #include "Ship.h"      // For managing ship-related operations.
+#include "Random.h"    // Per-game random number engine.
+#include "Heatmap.h"   // Placement counts for the HARD strategy.
+#include "SpaceSet.h"  // Constant-time set of spaces still worth firing at.
+#include "RolloutSearch.h" // Playout search for the ROLLOUT strategy.
+#include "HeatmapCache.h" // Weights shared across games for the HARD strategy.
 
 class Camden {
     private:
         Player* self {nullptr}; // Reference to Camden's player instance.
         Grid* foeGrid {nullptr}; // Reference to the opponent's grid for attacks.
         Ship* curVictimShip {nullptr}; // Pointer to the ship Camden is currently attacking.
+        CamdenType type {EASY}; // Strategy Camden plays with.
 
         // **Dynamic Game State Tracking**
-        vector<string> availableSpaces; // List of spaces Camden can target.
-        vector<string> attackSpaces;    // List of spaces currently involved in an attack sequence.
+        SpaceSet availableSpaces;          // Spaces Camden can target.
+        vector<SpaceName> attackSpaces;    // List of spaces currently involved in an attack sequence.
         vector<char> attackDirections; // Directions Camden is considering for attacks.
         vector<int> numShipsSank;      // History of the number of ships sunk by Camden.
+        Heatmap heatmap;               // Legal placements of the foe's ships (HARD and ROLLOUT).
+        SearchBudget budget;           // Work allowed per move (ROLLOUT).
+        HeatmapCache* heatmapCache {nullptr}; // Weights of states already seen (HARD), or nullptr for none.
 
         // **Attack State Management**
-        string firstAttackSpace; // First space hit in the current attack sequence.
-        string lastAttackSpace;  // Most recent space hit in the current attack sequence.
+        SpaceName firstAttackSpace {NO_SPACE}; // First space hit in the current attack sequence.
+        SpaceName lastAttackSpace {NO_SPACE};  // Most recent space hit in the current attack sequence.
         char directions[4] {'N','S','E','W'}; // Fixed array of possible attack directions.
         char attackDirection; // Current direction of attack.
 
@@ -39,32 +48,50 @@ class Camden {
         bool did_just_sink_ship_check2() const; // Checks if the current victim ship was just sunk.
         bool did_just_sink_ship() const;        // Combines the two sinking checks.
 
-        bool space_is_available(string space) const; // Validates if a space is targetable.
+        bool space_is_available(SpaceName space) const; // Validates if a space is targetable.
         void set_Camden();                           // Initializes Camden's default state.
         void switch_direction_to_opposite();         // Reverses the attack direction.
         void update_num_ships_sank();                // Updates the count of sunk ships.
         void check_for_holes();                      // Removes isolated spaces from target list.
-        void initiate_attack(string space);          // Starts targeting a specific ship.
+        void initiate_attack(SpaceName space);       // Starts targeting a specific ship.
         void remove_attack_direction(char direction); // Removes a direction from possible attacks.
-        void remove_available_space(string space);    // Removes a specific space from available targets.
-        void remove_available_spaces(vector<string> spaces); // Removes multiple spaces from available targets.
+        void remove_available_space(SpaceName space); // Removes a specific space from available targets.
+        void remove_available_spaces(const vector<SpaceName>& spaces); // Removes multiple spaces from available targets.
+        void remove_available_spaces(Bitboard spaces); // Removes a mask of spaces from available targets.
+        Bitboard attack_mask() const;                // The spaces of the current attack sequence as a mask.
         void reset_to_default();                     // Resets Camden's attack state.
         void do_switch();                            // Switches attack direction during an attack sequence.
-        bool is_a_hit(string space) const;           // Checks if a space contains a ship's stud.
-        string pick_direction(int(*rand_func)(), char& direction); // Picks a valid direction for attack.
-        string pick_attack_space(int(*rand_func)()); // Determines the next space to attack based on current strategy.
-        string pick_random_space(int(*rand_func)()); // Selects a random space from available targets.
+        bool is_a_hit(SpaceName space) const;        // Checks if a space contains a ship's stud.
+        SpaceName pick_direction(Random& rand_func, char& direction); // Picks a valid direction for attack.
+        SpaceName pick_attack_space(Random& rand_func); // Determines the next space to attack based on current strategy.
+        SpaceName pick_random_space(Random& rand_func); // Selects a random space from available targets.
+        SpaceName pick_blind_space(Random& rand_func); // Fires at any untried space, never following up hits (RANDOM).
+        SpaceName pick_dense_space(Random& rand_func); // Fires where the most legal placements overlap (HARD).
+        SpaceName pick_rollout_space(Random& rand_func); // Fires where playouts finish the game soonest (ROLLOUT).
+        RolloutSearch::Observation read_foe() const; // Sums up the foe grid.
+        RolloutSearch::Observation observe_foe();    // Brings the heatmap up to date and sums up the foe grid.
 
     public:
         // **Constructors and Destructor**
         Camden();                   // Default constructor.
         explicit Camden(Player* the_self); // Constructor initializing Camden with a reference to its player.
+        Camden(Player* the_self, CamdenType camden_type); // Constructor also choosing Camden's strategy.
         ~Camden();                  // Destructor to clean up pointers.
 
+        // **Getter Methods**
+        CamdenType getType() const; // Returns the strategy Camden plays with.
+
+        // **Setter Methods**
+        void setPrior(const PlacementPrior* prior); // Weights HARD hunting by where fleets were seen; nullptr for none.
+        void setSearchBudget(const SearchBudget& search_budget); // Work allowed per ROLLOUT move.
+        void setHeatmapCache(HeatmapCache* heatmap_cache); // Shares HARD weights with other Camdens; nullptr for none.
+
         // **Public Methods**
-        string makeAMove(int(*rand_func)()); // Main method to determine Camden's move during its turn.
-        void badBoy(string space);          // Marks a space as invalid and removes it from targets.
-        string makeMove(int(*rand_func)(), string bad_space = ""); // Handles Camden's move logic, incorporating invalid spaces.
+        SpaceName makeAMove(Random& rand_func); // Main method to determine Camden's move during its turn.
+        void badBoy(SpaceName space);       // Marks a space as invalid and removes it from targets.
+        SpaceName makeMove(Random& rand_func, SpaceName bad_space = NO_SPACE); // Handles Camden's move logic, incorporating invalid spaces.
+        SpaceName makeMove(Random& rand_func, const SearchBudget& search_budget, SpaceName bad_space = NO_SPACE); // Same, with a new budget for this and later moves.
+        void reset();                       // Forgets the last game, keeping the player, strategy and list capacity.
 };
 
 #endif
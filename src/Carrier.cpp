@@ -3,14 +3,13 @@
 
 #include "Enums.h"     // For ShipType and PlayerType enumerations.
 #include "Grid.h"      // For placing the Carrier on the grid.
+#include "Placements.h" // For the table of legal Carrier placements.
 #include "Stud.h"      // For managing the Carrier's studs.
 
 #include <string>
     using std::string; // For space and ship names.
 #include <array>
     using std::array;  // To manage fixed-size arrays for studs.
-#include <stdexcept>
-    using std::out_of_range; // For exception handling during grid operations.
 #include <iostream>
     using std::cout;
     using std::endl;
@@ -42,7 +41,7 @@ Carrier::Carrier(Grid* on_grid, string start_space, char direction) : Ship(ShipT
 // Cleans up dynamically allocated memory for the studs.
 Carrier::~Carrier() {
     for(size_t i = 0; i < 5; ++i) {
-        delete this->studs[i]; // Deallocate each stud.
+        Arena::destroy(this->arena, this->studs[i]); // Deallocate each stud.
         this->studs[i] = nullptr; // Set the pointer to nullptr.
     }
 } 
@@ -75,41 +74,37 @@ bool Carrier::hasStud(Stud* stud) const {
 // Initializes the Carrier's studs and associates them with the player and the ship.
 void Carrier::setStuds() {
     for(size_t i = 0; i < 5; i++) {
-        this->studs[i] = new Stud(Studs::studNames[i], this->ofPlayer, this); // Dynamically allocate new studs.
-        this->intactStuds.push_back(this->studs[i]); // Add the stud to the intact list.
+        this->studs[i] = Arena::make<Stud>(this->arena, Studs::studNames[i], this->ofPlayer, this); // Dynamically allocate new studs.
+        this->add_stud(this->studs[i]); // Add the stud to the intact list.
     }
 }
 
 // **Place Carrier on the Grid**
 // Tries to place the Carrier on the grid starting from a specific space and direction.
 // Returns true if placement is successful, otherwise false.
-bool Carrier::placeOnGrid(string start_space, char direction, bool print_out) const {
-    vector<string> ship_spaces;
-    try {
-        // Attempt to get a vector of grid spaces for the Carrier.
-        ship_spaces = Grid::getVector(start_space, direction, 4); // Carrier has a length of 5 (4 additional spaces from the start).
-    } catch (out_of_range& e) {
-        // Handle out-of-bound placement attempts.
+bool Carrier::placeOnGrid(SpaceName start_space, char direction, bool print_out) const {
+    // Look up the Carrier's spaces and halo in the placement table (Carrier has a length of 5).
+    const Placement& placement = Placements::at(5, start_space, direction);
+    if(!placement.fits()) {
+        // Handle placements that would run off the grid.
         if(print_out)
             cout << "Out of range." << endl;
         return false; // Placement failed.
     }
 
-    // Check if any of the intended spaces conflict with existing ships.
-    if(this->onGrid->hasNoGoSpace(ship_spaces)) {
+    // Check if any of the intended spaces are occupied by or adjacent to other ships.
+    if(!this->onGrid->canPlace(placement)) {
         if(print_out)
             cout << "Ships cannot be touching." << endl;
         return false; // Placement failed.
     }
 
     // Place the Carrier's studs on the grid.
-    for(size_t i = 0; i < 5; i++)
-        this->onGrid->setOnSpace(ship_spaces[i], this->studs[i]);
+    for(int i = 0; i < 5; i++)
+        this->onGrid->setOnSpace(placement.spaceAt(i), this->studs[i]);
 
-    // Mark surrounding spaces as no-go zones.
-    vector<string> ship_neighbors = Grid::neighborSpaces(ship_spaces);
-    this->onGrid->addNoGoSpaces(ship_spaces);       // Add the Carrier's spaces to no-go zones.
-    this->onGrid->addNoGoSpaces(ship_neighbors);    // Add neighboring spaces to no-go zones.
+    // Mark the Carrier's spaces and their neighbors as no-go zones.
+    this->onGrid->addNoGoSpaces(placement.mask | placement.halo);
 
     return true; // Placement successful.
 }
@@ -3,14 +3,13 @@
 
 #include "Enums.h"     // For enumerations like ShipType and PlayerType.
 #include "Grid.h"      // For handling the grid placement of ships.
+#include "Placements.h" // For the table of legal Cruiser placements.
 #include "Stud.h"      // For managing the Cruiser's studs.
 
 #include <string>
     using std::string; // For managing strings related to spaces.
 #include <array>
     using std::array;  // Fixed-size array for the Cruiser's studs.
-#include <stdexcept>
-    using std::out_of_range; // Exception handling for grid operations.
 #include <iostream>
     using std::cout;
     using std::endl;
@@ -42,7 +41,7 @@ Cruiser::Cruiser(Grid* on_grid, string start_space, char direction) : Ship(ShipT
 // Cleans up dynamically allocated memory for the Cruiser's studs.
 Cruiser::~Cruiser() {
     for(size_t i = 0; i < 2; ++i) {
-        delete this->studs[i]; // Free memory for each stud.
+        Arena::destroy(this->arena, this->studs[i]); // Free memory for each stud.
         this->studs[i] = nullptr; // Set the pointer to nullptr.
     }
 }
@@ -75,41 +74,37 @@ bool Cruiser::hasStud(Stud* stud) const {
 // Creates and initializes the Cruiser's studs.
 void Cruiser::setStuds() {
     for(size_t i = 15, j = 0; i < 17; i++, j++) { // Cruiser uses studs indexed from 15 to 16.
-        this->studs[j] = new Stud(Studs::studNames[i], this->ofPlayer, this); // Create new studs dynamically.
-        this->intactStuds.push_back(this->studs[j]); // Add the new stud to the list of intact studs.
+        this->studs[j] = Arena::make<Stud>(this->arena, Studs::studNames[i], this->ofPlayer, this); // Create new studs dynamically.
+        this->add_stud(this->studs[j]); // Add the new stud to the list of intact studs.
     }
 }
 
 // **Place Cruiser on the Grid**
 // Tries to place the Cruiser on the grid starting at a given space and direction.
 // Returns true if placement is successful, otherwise false.
-bool Cruiser::placeOnGrid(string start_space, char direction, bool print_out) const {
-    vector<string> ship_spaces; // Stores the spaces that the Cruiser will occupy.
-    try {
-        // Try to calculate the required grid spaces for the Cruiser.
-        ship_spaces = Grid::getVector(start_space, direction, 1); // Cruiser has a length of 2 (1 additional space from the start).
-    } catch (out_of_range& e) {
-        // Handle cases where the placement goes out of the grid's bounds.
+bool Cruiser::placeOnGrid(SpaceName start_space, char direction, bool print_out) const {
+    // Look up the Cruiser's spaces and halo in the placement table (Cruiser has a length of 2).
+    const Placement& placement = Placements::at(2, start_space, direction);
+    if(!placement.fits()) {
+        // Handle placements that would run off the grid.
         if(print_out)
             cout << "Out of range." << endl;
         return false; // Placement failed.
     }
 
-    // Check if any of the intended spaces conflict with existing ships.
-    if(this->onGrid->hasNoGoSpace(ship_spaces)) {
+    // Check if any of the intended spaces are occupied by or adjacent to other ships.
+    if(!this->onGrid->canPlace(placement)) {
         if(print_out)
             cout << "Ships cannot be touching." << endl;
         return false; // Placement failed.
     }
 
     // Place the Cruiser's studs on the grid.
-    for(size_t i = 0; i < 2; i++) 
-        this->onGrid->setOnSpace(ship_spaces[i], this->studs[i]);
+    for(int i = 0; i < 2; i++)
+        this->onGrid->setOnSpace(placement.spaceAt(i), this->studs[i]);
 
-    // Mark surrounding spaces as no-go zones to avoid overlapping with other ships.
-    vector<string> ship_neighbors = Grid::neighborSpaces(ship_spaces);
-    this->onGrid->addNoGoSpaces(ship_spaces);       // Add the Cruiser's spaces to no-go zones.
-    this->onGrid->addNoGoSpaces(ship_neighbors);    // Add neighboring spaces to no-go zones.
+    // Mark the Cruiser's spaces and their neighbors as no-go zones.
+    this->onGrid->addNoGoSpaces(placement.mask | placement.halo);
 
     return true; // Placement was successful.
 }
@@ -3,14 +3,13 @@
 
 #include "Enums.h"  // For enumerations like ShipType, PlayerType, and StudName.
 #include "Grid.h"   // For handling grid-related operations.
+#include "Placements.h" // For the table of legal Destroyer placements.
 #include "Stud.h"   // For managing the Destroyer's studs.
 
 #include <string>
     using std::string; // For string manipulation.
 #include <array>
     using std::array;  // Fixed-size array for the Destroyer's studs.
-#include <stdexcept>
-    using std::out_of_range; // Exception handling for invalid grid placements.
 #include <iostream>
     using std::cout;
     using std::endl;
@@ -42,7 +41,7 @@ Destroyer::Destroyer(Grid* on_grid, string start_space, char direction) : Ship (
 // Cleans up dynamically allocated memory for the Destroyer's studs.
 Destroyer::~Destroyer() {
     for(size_t i = 0; i < 3; ++i) {
-        delete this->studs[i]; // Free memory for each stud.
+        Arena::destroy(this->arena, this->studs[i]); // Free memory for each stud.
         this->studs[i] = nullptr; // Set the pointer to nullptr for safety.
     }
 }
@@ -77,41 +76,37 @@ bool Destroyer::hasStud(Stud* stud) const {
 // Dynamically allocates and initializes the studs for the Destroyer.
 void Destroyer::setStuds() {
     for(size_t i = 9, j = 0; i < 12; i++, j++) { // Destroyer uses studs indexed from 9 to 11.
-        this->studs[j] = new Stud(Studs::studNames[i], this->ofPlayer, this); // Create new studs dynamically.
-        this->intactStuds.push_back(this->studs[j]); // Add the stud to the list of intact studs.
+        this->studs[j] = Arena::make<Stud>(this->arena, Studs::studNames[i], this->ofPlayer, this); // Create new studs dynamically.
+        this->add_stud(this->studs[j]); // Add the stud to the list of intact studs.
     }
 }
 
 // **Place Destroyer on the Grid**
 // Tries to place the Destroyer starting at a given space and direction.
 // Returns true if the placement is successful; otherwise, false.
-bool Destroyer::placeOnGrid(string start_space, char direction, bool print_out) const {
-    vector<string> ship_spaces; // Stores the grid spaces that the Destroyer will occupy.
-    try {
-        // Calculate the grid spaces required for the Destroyer.
-        ship_spaces = Grid::getVector(start_space, direction, 2); // Destroyer has a length of 3 (2 additional spaces from the start).
-    } catch (out_of_range& e) {
-        // Handle cases where placement goes out of the grid's boundaries.
+bool Destroyer::placeOnGrid(SpaceName start_space, char direction, bool print_out) const {
+    // Look up the Destroyer's spaces and halo in the placement table (Destroyer has a length of 3).
+    const Placement& placement = Placements::at(3, start_space, direction);
+    if(!placement.fits()) {
+        // Handle placements that would run off the grid.
         if(print_out)
             cout << "Out of range." << endl;
         return false; // Placement failed.
     }
 
-    // Check if the spaces are already occupied or adjacent to other ships.
-    if(this->onGrid->hasNoGoSpace(ship_spaces)) {
+    // Check if any of the intended spaces are occupied by or adjacent to other ships.
+    if(!this->onGrid->canPlace(placement)) {
         if(print_out)
             cout << "Ships cannot be touching." << endl;
         return false; // Placement failed.
     }
 
     // Place the Destroyer's studs on the grid.
-    for(size_t i = 0; i < 3; i++) 
-        this->onGrid->setOnSpace(ship_spaces[i], this->studs[i]);
+    for(int i = 0; i < 3; i++)
+        this->onGrid->setOnSpace(placement.spaceAt(i), this->studs[i]);
 
-    // Mark neighboring spaces as no-go zones to prevent overlapping with other ships.
-    vector<string> ship_neighbors = Grid::neighborSpaces(ship_spaces);
-    this->onGrid->addNoGoSpaces(ship_spaces);    // Add the Destroyer's spaces to the no-go zones.
-    this->onGrid->addNoGoSpaces(ship_neighbors); // Add neighboring spaces to the no-go zones.
+    // Mark the Destroyer's spaces and their neighbors as no-go zones.
+    this->onGrid->addNoGoSpaces(placement.mask | placement.halo);
 
     return true; 
 }
@@ -32,7 +32,8 @@ class Destroyer : public Ship {
         // Override methods from the base class.
         bool hasStud(Stud* stud) const override; // Checks if a given stud is part of the destroyer.
         void setStuds() override; // Initializes the studs of the destroyer.
-        bool placeOnGrid(string start_space, char direction, bool print_out = true) const override; // Places the destroyer on the grid.
+        using Ship::placeOnGrid; // Keeps the string overload from Ship visible.
+        bool placeOnGrid(SpaceName start_space, char direction, bool print_out = true) const override; // Places the destroyer on the grid.
 };
 
 #endif // End of include guard.
@@ -1,50 +1,49 @@
 #include <string> // Include string for handling text.
     using std::string; // Use string from the standard namespace.
 
+#include <string_view> // Include string_view for reading text without copying it.
+    using std::string_view; // Use string_view from the standard namespace.
+
 #include <stdexcept> // Include for handling exceptions like invalid_argument.
     using std::invalid_argument; // Use invalid_argument from the standard namespace.
 
 #include "Enums.h" // Include Enums for enumerated types and related data.
 
-// Method: Checks if a given space string is valid by comparing it with known space strings.
-bool Spaces::isSpaceString(string space_string) {
-    for(string a_space_string : spaceStrings) // Iterate through all known space strings.
-        if(space_string == a_space_string) // Check if the input matches any of the known strings.
-            return true; // Return true if a match is found.
-    return false; // Return false if no match is found.
+// Compile-time checks of the parser against the string table.
+static_assert(Spaces::parse("A1") == A1 && Spaces::parse("J1") == J1 && Spaces::parse("A10") == A10 && Spaces::parse("J10") == J10, "parse maps the corners");
+static_assert(Spaces::parse("") == NO_SPACE && Spaces::parse("K1") == NO_SPACE && Spaces::parse("A0") == NO_SPACE && Spaces::parse("A11") == NO_SPACE && Spaces::parse("a1") == NO_SPACE, "parse rejects non-spaces");
+static_assert(Spaces::viewFromName(E7) == "E7" && Spaces::parse(Spaces::viewFromName(H10)) == H10, "viewFromName inverts parse");
+
+// Method: Checks if a given space string is valid.
+bool Spaces::isSpaceString(string_view space_string) {
+    return parse(space_string) != NO_SPACE; // Valid exactly when it parses to a space.
 }
 
 // Method: Converts a valid space string to its corresponding SpaceName.
-SpaceName Spaces::nameFromString(string space_string) {
-    for (size_t i = 0; i < 100; i++) { // Iterate through spaceStrings up to 100 elements.
-        if (spaceStrings[i] == space_string) // Check if the input matches the current string.
-            return spaceNames[i]; // Return the corresponding SpaceName.
-    }
-    throw invalid_argument("Bad argument: " + space_string); // Throw exception if no match is found.
+SpaceName Spaces::nameFromString(string_view space_string) {
+    SpaceName space_name = parse(space_string); // Reads the column letter and row number directly.
+    if (space_name == NO_SPACE)
+        throw invalid_argument("Bad argument: " + string(space_string)); // Throw exception if it is not a space.
+    return space_name; // Return the corresponding SpaceName.
 }
 
 // Method: Converts a SpaceName to its corresponding space string.
 string Spaces::stringFromName(SpaceName space_name) {
-    size_t space_name_int = static_cast<size_t>(space_name); // Convert SpaceName to an integer.
-    return spaceStrings[space_name_int - 1]; // Return the corresponding space string (adjusted for 0-indexing).
+    return string(viewFromName(space_name)); // Copy the text out of the string table.
 }
 
 // Method: Converts a character representing a column to its corresponding Column enumeration value.
 Column Spaces::columnFromChar(char the_char) {
-    for(size_t i = 0; i < 10; i++) { // Iterate through columnChars array.
-        if (columnChars[i] == the_char) // Check if the input character matches.
-            return columnNames[i]; // Return the corresponding Column.
-    }
-    throw invalid_argument("Bad argument: " + the_char); // Throw exception if no match is found.
+    if (the_char < 'A' || the_char > 'J') // Columns run from 'A' to 'J'.
+        throw invalid_argument("Bad argument: " + string(1, the_char)); // Throw exception if it is not a column.
+    return static_cast<Column>(the_char); // Column values are their own letters.
 }
 
 // Method: Converts a character representing a row to its corresponding Row enumeration value.
 Row Spaces::rowFromChar(char the_char) {
-    for(size_t i = 0; i < 10; i++) { // Iterate through rowChars array.
-        if (rowChars[i] == the_char) // Check if the input character matches.
-            return rowNames[i]; // Return the corresponding Row.
-    }
-    throw invalid_argument("Bad argument: " + the_char); // Throw exception if no match is found.
+    if (the_char < '0' || the_char > '9') // Rows run from '1' to '9', with '0' for row 10.
+        throw invalid_argument("Bad argument: " + string(1, the_char)); // Throw exception if it is not a row.
+    return the_char == '0' ? TEN : static_cast<Row>(the_char - '0'); // Row values are their own numbers.
 }
 
 // Method: Converts a Column enumeration value to its corresponding character representation.
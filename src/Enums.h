@@ -4,6 +4,9 @@
 #include <string> // Include for using the string class.
     using std::string; // Use string from the standard namespace.
 
+#include <string_view> // Include for using the string_view class.
+    using std::string_view; // Use string_view from the standard namespace.
+
 // Enumeration representing the status of a space on the game grid.
 enum SpaceStatus {UNTARGETED, TARGETED}; // UNTARGETED means not hit, TARGETED means hit.
 
@@ -17,7 +20,7 @@ enum ShipStatus {AFLOAT, SUNKEN}; // AFLOAT means not sunk, SUNKEN means fully c
 enum StudName {A_1, A_2, A_3, A_4, A_5, B_1, B_2, B_3, B_4, D_1, D_2, D_3, S_1, S_2, S_3, C_1, C_2}; // Various names of ship parts.
 
 // Enumeration representing the columns of the grid.
-enum Column {ALPHA = 'A', BRAVO, CHARLIE, DELTA, ECHO, FOXTROT, GULF, INDIA, JULIET}; // Column names using military phonetic alphabet.
+enum Column {ALPHA = 'A', BRAVO, CHARLIE, DELTA, ECHO, FOXTROT, GULF, HOTEL, INDIA, JULIET}; // Column names using military phonetic alphabet.
 
 // Enumeration representing the rows of the grid.
 enum Row {ONE = 1, TWO, THREE, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN}; // Row numbers from 1 to 10.
@@ -26,7 +29,10 @@ enum Row {ONE = 1, TWO, THREE, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN}; // Row
 enum ShipType {CARRIER, BATTLESHIP, SUBMARINE, DESTROYER, CRUISER}; // Different types of ships.
 
 // Enumeration representing the levels of difficulty for Camden's AI.
-enum CamdenType {EASY, HARD}; // EASY and HARD difficulty levels.
+enum CamdenType {RANDOM, EASY, HARD, ROLLOUT}; // RANDOM fires blindly; EASY and HARD difficulty levels; ROLLOUT searches by playouts.
+
+// Enumeration representing how random fleets are drawn.
+enum FleetMode {SEQUENTIAL, UNIFORM}; // SEQUENTIAL places ship by ship as autoSetShips does; UNIFORM draws every legal fleet equally often.
 
 // Enumeration representing the result of targeting a space.
 enum TargetResult {MISS, HIT}; // MISS means no ship hit, HIT means a ship was hit.
@@ -36,6 +42,7 @@ enum PlayerType {CPU, MAN}; // CPU for computer-controlled, MAN for human player
 
 // Enumeration representing the names of spaces on the grid.
 enum SpaceName {
+    NO_SPACE = 0, // Sentinel for "no space" (e.g. no rejected move yet).
     A1 = 1, B1, C1, D1, E1, F1, G1, H1, I1, J1,
     A2, B2, C2, D2, E2, F2, G2, H2, I2, J2,
     A3, B3, C3, D3, E3, F3, G3, H3, I3, J3,
@@ -64,8 +71,8 @@ struct Spaces {
         A10, B10, C10, D10, E10, F10, G10, H10, I10, J10 // Full grid of space names.
     };
 
-    // Static array mapping space names to string representations.
-    inline static string spaceStrings[] = {
+    // Static array mapping space names to string representations, indexed by SpaceName - 1.
+    inline static constexpr string_view spaceStrings[] = {
         "A1", "B1", "C1", "D1", "E1", "F1", "G1", "H1", "I1", "J1",
         "A2", "B2", "C2", "D2", "E2", "F2", "G2", "H2", "I2", "J2",
         "A3", "B3", "C3", "D3", "E3", "F3", "G3", "H3", "I3", "J3",
@@ -79,19 +86,54 @@ struct Spaces {
     };
 
     // Static arrays for column and row data.
-    inline static Column columnNames[] = {ALPHA, BRAVO, CHARLIE, DELTA, ECHO, FOXTROT, GULF, INDIA, JULIET}; // Columns A to J.
+    inline static Column columnNames[] = {ALPHA, BRAVO, CHARLIE, DELTA, ECHO, FOXTROT, GULF, HOTEL, INDIA, JULIET}; // Columns A to J.
     inline static Row rowNames[] = {ONE, TWO, THREE, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN}; // Rows 1 to 10.
     inline static char columnChars[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J'}; // Characters representing columns.
     inline static char rowChars[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '0'}; // Characters representing rows (0 represents 10).
 
     // Static methods for conversions and checks.
-    static bool isSpaceString(string space_string); // Checks if a string represents a valid space.
-    static SpaceName nameFromString(string space_string); // Converts a string to a SpaceName.
+    static bool isSpaceString(string_view space_string); // Checks if a string represents a valid space.
+    static SpaceName nameFromString(string_view space_string); // Converts a string to a SpaceName; throws if it is not a space.
     static string stringFromName(SpaceName space_name); // Converts a SpaceName to a string.
     static Column columnFromChar(char the_char); // Converts a character to a Column.
     static Row rowFromChar(char the_char); // Converts a character to a Row.
     static char charFromColumn(Column the_column); // Converts a Column to a character.
     static char charFromRow(Row the_row); // Converts a Row to a character.
+
+    // Allocation-free parsing and formatting, usable in constant expressions.
+    static constexpr SpaceName parse(string_view space_string) { // "A1" to "J10" by arithmetic, or NO_SPACE if the string is not a space.
+        size_t length = space_string.size();
+        if (length < 2 || length > 3)
+            return NO_SPACE;
+        int column_index = space_string[0] - 'A';
+        if (column_index < 0 || column_index > 9)
+            return NO_SPACE;
+        int row_index = space_string[1] - '1';
+        if (length == 3) {
+            if (space_string[1] != '1' || space_string[2] != '0')
+                return NO_SPACE;
+            row_index = 9;
+        }
+        else if (row_index < 0 || row_index > 8)
+            return NO_SPACE;
+        return nameFromIndices(column_index, row_index);
+    }
+    static constexpr string_view viewFromName(SpaceName space_name) { // Text of a space; the view points into spaceStrings.
+        return spaceStrings[static_cast<size_t>(space_name) - 1];
+    }
+
+    // Index arithmetic on SpaceName (A1 = 1, J1 = 10, A2 = 11, ..., J10 = 100).
+    static constexpr int columnIndex(SpaceName space_name) { return (static_cast<int>(space_name) - 1) % 10; } // 0 for A, 9 for J.
+    static constexpr int rowIndex(SpaceName space_name) { return (static_cast<int>(space_name) - 1) / 10; } // 0 for row 1, 9 for row 10.
+    static constexpr SpaceName nameFromIndices(int column_index, int row_index) { // Inverse of columnIndex and rowIndex.
+        return static_cast<SpaceName>(row_index * 10 + column_index + 1);
+    }
+};
+
+// Struct containing static members related to ship properties.
+struct Ships {
+    inline static constexpr int shipLengths[] = {5, 4, 3, 3, 2}; // Studs per ship, indexed by ShipType.
+    static constexpr int lengthOf(ShipType ship_type) { return shipLengths[ship_type]; } // Studs in a ship of this type.
 };
 
 // Struct containing static members related to stud properties.
@@ -0,0 +1,270 @@
+#include "FleetCounter.h"
+
+#include "Enums.h"         // Ship types and lengths.
+#include "Bitboard.h"      // Masks.
+#include "RolloutSearch.h" // Observations.
+#include "ThreadPool.h"    // Workers.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <algorithm>
+    using std::sort;
+    using std::lower_bound;
+
+// Profile entries, six bits per column. A vertical ship's entry packs its type, the
+// spaces it has so far and whether every one of them is a hit.
+static constexpr uint64_t EMPTY = 0;     // The space is empty.
+static constexpr uint64_t DONE = 1;      // The space is taken and the one below must be empty.
+static constexpr int ENTRY_BITS = 6;
+static constexpr uint64_t ENTRY_MASK = (uint64_t(1) << ENTRY_BITS) - 1;
+
+// Code of a ship of type ship_type with progress cells laid (or left, for the
+// horizontal ship) and all_hit set while every one of them is a hit.
+static constexpr uint64_t shipCode(int ship_type, int progress, bool all_hit) {
+    return 2 + (static_cast<uint64_t>(ship_type * 4 + progress - 1) << 1 | (all_hit ? 1 : 0));
+}
+static constexpr int codeType(uint64_t code) { return static_cast<int>((code - 2) >> 1) / 4; }
+static constexpr int codeProgress(uint64_t code) { return static_cast<int>((code - 2) >> 1) % 4 + 1; }
+static constexpr bool codeAllHit(uint64_t code) { return (code - 2) & 1; }
+
+// One state of the programme and the arrangements reaching it. rest holds the
+// horizontal ship's code (0 for none) in its low six bits and the used types above.
+struct CountState {
+    uint64_t profile;
+    uint64_t rest;
+    uint64_t count;
+
+    bool operator<(const CountState& other) const {
+        return this->profile != other.profile ? this->profile < other.profile : this->rest < other.rest;
+    }
+};
+
+// What the programme knows of one space.
+struct CountCell {
+    int rowIndex;
+    int columnIndex;
+    bool mustBeEmpty;   // A miss, a sunk ship or next to one.
+    bool mustBeHit;     // An unresolved hit.
+};
+
+// Layers kept between checkpoints while the occupancy pass walks back.
+static constexpr int CHECKPOINT_STRIDE = 10;
+
+// States handed to a worker at a time.
+static constexpr size_t STATE_CHUNK = 1024;
+
+// **Spaces and Types**
+// Reads the observations into one CountCell per space and the afloat types into a
+// mask; false if a hit is also forced empty, so nothing fits.
+static bool prepare(const RolloutSearch::Observation& observation, Bitboard extra_empty, array<CountCell, 100>& cells, uint64_t& afloat_types) {
+    Bitboard unresolved = observation.hits & ~observation.sunk;
+    Bitboard forced_empty = (observation.targeted & ~observation.hits) | observation.sunk.spread() | extra_empty;
+    for (int i = 0; i < 100; ++i)
+        cells[i] = CountCell {i / 10, i % 10, forced_empty.test(i), unresolved.test(i)};
+    afloat_types = 0;
+    for (int k = 0; k < observation.numAfloat; ++k)
+        afloat_types |= uint64_t(1) << observation.afloat[k];
+    return !unresolved.intersects(forced_empty);
+}
+
+// **Extend a State**
+// Calls emit(profile, rest, taken) for each way the space can be filled.
+template <typename Emit>
+static void extend(const CountState& state, const CountCell& cell, uint64_t afloat_types, Emit&& emit) {
+    int shift = cell.columnIndex * ENTRY_BITS;
+    uint64_t up = state.profile >> shift & ENTRY_MASK;
+    bool left_taken = cell.columnIndex > 0 && (state.profile >> (shift - ENTRY_BITS) & ENTRY_MASK) != EMPTY;
+    uint64_t horizontal = state.rest & ENTRY_MASK;
+    uint64_t used = state.rest >> ENTRY_BITS;
+    uint64_t cleared = state.profile & ~(ENTRY_MASK << shift);
+    auto fill = [&](uint64_t entry, uint64_t new_horizontal, uint64_t new_used) {
+        emit(cleared | entry << shift, new_used << ENTRY_BITS | new_horizontal, entry != EMPTY);
+    };
+
+    if (up >= 2) {
+        // A vertical ship above must grow into this space.
+        if (horizontal != 0 || left_taken || cell.mustBeEmpty)
+            return;
+        int ship_type = codeType(up);
+        int cells = codeProgress(up) + 1;
+        bool all_hit = codeAllHit(up) && cell.mustBeHit;
+        if (cells == Ships::lengthOf(static_cast<ShipType>(ship_type))) {
+            if (!all_hit)
+                fill(DONE, 0, used);
+        } else {
+            fill(shipCode(ship_type, cells, all_hit), 0, used);
+        }
+    } else if (up == DONE) {
+        // A ship ended above, so this space stays empty.
+        if (horizontal == 0 && !cell.mustBeHit)
+            fill(EMPTY, 0, used);
+    } else if (horizontal != 0) {
+        // The horizontal ship to the left goes on.
+        if (cell.mustBeEmpty)
+            return;
+        int ship_type = codeType(horizontal);
+        int left = codeProgress(horizontal) - 1;
+        bool all_hit = codeAllHit(horizontal) && cell.mustBeHit;
+        if (left == 0) {
+            if (!all_hit)
+                fill(DONE, 0, used);
+        } else {
+            fill(DONE, shipCode(ship_type, left, all_hit), used);
+        }
+    } else {
+        // Empty, or the first space of an unused ship going E or S.
+        if (!cell.mustBeHit)
+            fill(EMPTY, 0, used);
+        if (cell.mustBeEmpty || left_taken)
+            return;
+        for (int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+            uint64_t bit = uint64_t(1) << ship_type;
+            if (!(afloat_types & bit) || (used & bit))
+                continue;
+            int length = Ships::lengthOf(static_cast<ShipType>(ship_type));
+            if (cell.columnIndex + length <= 10)
+                fill(DONE, shipCode(ship_type, length - 1, cell.mustBeHit), used | bit);
+            if (cell.rowIndex + length <= 10)
+                fill(shipCode(ship_type, 1, cell.mustBeHit), 0, used | bit);
+        }
+    }
+}
+
+// **Advance a Layer**
+// Extends every state by one space, on the pool's workers if there is one, then
+// sorts and merges the states that became equal.
+static void advance(const vector<CountState>& states, const CountCell& cell, uint64_t afloat_types, vector<CountState>& next, ThreadPool* pool) {
+    next.clear();
+    if (pool == nullptr || states.size() < STATE_CHUNK) {
+        for (const CountState& state : states)
+            extend(state, cell, afloat_types, [&](uint64_t profile, uint64_t rest, bool) {
+                next.push_back(CountState {profile, rest, state.count});
+            });
+    } else {
+        vector<vector<CountState>> parts(pool->size());
+        pool->parallelFor(states.size(), STATE_CHUNK, [&](size_t worker, size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j)
+                extend(states[j], cell, afloat_types, [&](uint64_t profile, uint64_t rest, bool) {
+                    parts[worker].push_back(CountState {profile, rest, states[j].count});
+                });
+        });
+        for (const vector<CountState>& part : parts)
+            next.insert(next.end(), part.begin(), part.end());
+    }
+    sort(next.begin(), next.end());
+    size_t kept = 0;
+    for (size_t j = 0; j < next.size(); ++j) {
+        if (kept > 0 && next[kept - 1].profile == next[j].profile && next[kept - 1].rest == next[j].rest)
+            next[kept - 1].count += next[j].count;
+        else
+            next[kept++] = next[j];
+    }
+    next.resize(kept);
+}
+
+// **Whole Arrangements**
+// Every afloat ship laid and none still growing.
+static bool accepting(const CountState& state, uint64_t afloat_types) {
+    for (int column_index = 0; column_index < 10; ++column_index)
+        if ((state.profile >> (column_index * ENTRY_BITS) & ENTRY_MASK) >= 2)
+            return false;
+    return state.rest == afloat_types << ENTRY_BITS;
+}
+
+// **Count**
+// Walks the spaces in reading order, keeping only the current layer of states.
+uint64_t FleetCounter::count(const RolloutSearch::Observation& observation, Bitboard extra_empty, ThreadPool* pool) {
+    array<CountCell, 100> cells;
+    uint64_t afloat_types;
+    if (!prepare(observation, extra_empty, cells, afloat_types))
+        return 0;
+    vector<CountState> states {CountState {0, 0, 1}};
+    vector<CountState> next;
+    for (const CountCell& cell : cells) {
+        advance(states, cell, afloat_types, next, pool);
+        states.swap(next);
+    }
+    uint64_t total = 0;
+    for (const CountState& state : states)
+        if (accepting(state, afloat_types))
+            total += state.count;
+    return total;
+}
+
+// **Occupancy**
+// Forward, each state carries the partial arrangements reaching it; backward, the
+// completions leaving it. A space's taken count sums, over the states before it and
+// the ways of filling it with a ship, reaching times completing. Only every tenth
+// layer is kept on the way forward; each block of ten is rebuilt from its checkpoint
+// on the way back, so memory stays near a fifth of all layers.
+FleetCounts FleetCounter::occupancy(const RolloutSearch::Observation& observation, ThreadPool* pool) {
+    FleetCounts counts;
+    array<CountCell, 100> cells;
+    uint64_t afloat_types;
+    if (!prepare(observation, Bitboard(), cells, afloat_types))
+        return counts;
+
+    vector<vector<CountState>> checkpoints; // Layer CHECKPOINT_STRIDE * c before space CHECKPOINT_STRIDE * c.
+    vector<CountState> states {CountState {0, 0, 1}};
+    vector<CountState> next;
+    for (int i = 0; i < 100; ++i) {
+        if (i % CHECKPOINT_STRIDE == 0)
+            checkpoints.push_back(states);
+        advance(states, cells[i], afloat_types, next, pool);
+        states.swap(next);
+    }
+
+    // Completions of the last layer: 1 for a whole arrangement, 0 otherwise.
+    vector<uint64_t> completions(states.size());
+    for (size_t j = 0; j < states.size(); ++j) {
+        completions[j] = accepting(states[j], afloat_types) ? 1 : 0;
+        counts.total += states[j].count * completions[j];
+    }
+    vector<CountState> later = states; // The layer completions belong to.
+
+    size_t num_workers = pool != nullptr ? pool->size() : 1;
+    for (int block = static_cast<int>(checkpoints.size()) - 1; block >= 0; --block) {
+        int first = block * CHECKPOINT_STRIDE;
+        int last = first + CHECKPOINT_STRIDE < 100 ? first + CHECKPOINT_STRIDE : 100;
+        vector<vector<CountState>> layers {checkpoints[block]};
+        for (int i = first; i + 1 < last; ++i) {
+            layers.emplace_back();
+            advance(layers[layers.size() - 2], cells[i], afloat_types, layers.back(), pool);
+        }
+        for (int i = last - 1; i >= first; --i) {
+            const vector<CountState>& layer = layers[i - first];
+            vector<uint64_t> earlier(layer.size());
+            vector<uint64_t> taken(num_workers, 0);
+            auto walk_back = [&](size_t worker, size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    uint64_t all = 0;
+                    uint64_t with_ship = 0;
+                    extend(layer[j], cells[i], afloat_types, [&](uint64_t profile, uint64_t rest, bool is_taken) {
+                        CountState key {profile, rest, 0};
+                        size_t index = static_cast<size_t>(lower_bound(later.begin(), later.end(), key) - later.begin());
+                        all += completions[index];
+                        if (is_taken)
+                            with_ship += completions[index];
+                    });
+                    earlier[j] = all;
+                    taken[worker] += layer[j].count * with_ship;
+                }
+            };
+            if (pool != nullptr && layer.size() >= STATE_CHUNK)
+                pool->parallelFor(layer.size(), STATE_CHUNK, walk_back);
+            else
+                walk_back(0, 0, layer.size());
+            for (uint64_t part : taken)
+                counts.occupied[i] += part;
+            completions.swap(earlier);
+            later = layer;
+        }
+        checkpoints[block].clear();
+        checkpoints[block].shrink_to_fit();
+    }
+    return counts;
+}
@@ -0,0 +1,47 @@
+#ifndef FLEETCOUNTER_H
+#define FLEETCOUNTER_H
+
+#include "Enums.h"         // Ship types.
+#include "Bitboard.h"      // Observations as sets of spaces.
+#include "RolloutSearch.h" // What the shooter has observed.
+#include "ThreadPool.h"    // Workers for the per-space counts.
+
+#include <array>
+    using std::array;
+
+#include <cstdint>
+    using std::uint64_t;
+
+// **FleetCounts Struct**
+// Exact counts over every arrangement of the afloat ships that fits the observations.
+struct FleetCounts {
+    uint64_t total {0};                // Fitting arrangements.
+    array<uint64_t, 100> occupied {};  // Fitting arrangements with an afloat ship on each space.
+
+    double probability(int index) const { // Share of the arrangements with a ship on the space at bit index.
+        return this->total ? static_cast<double>(this->occupied[index]) / static_cast<double>(this->total) : 0.0;
+    }
+};
+
+// **FleetCounter Class**
+// Counts the arrangements of the afloat ships that fit what the shooter has seen,
+// exactly, with a dynamic programme over the grid in reading order rather than by
+// listing fleets. The state between two spaces is the profile of the last ten
+// spaces (empty; taken with the space below forced empty; or a vertical ship of a
+// known type still growing), the horizontal ship being laid if any, and the afloat
+// types already used. Misses, sunk ships and their halos force a space empty;
+// unresolved hits force it taken; ships never touch and one hit everywhere counts
+// as sunk, so it is left out. Arrangements are counted once each, which is the
+// UNIFORM fleet distribution, and ships of the same length count as different.
+// With a pool, each layer's states are shared out over its workers.
+class FleetCounter {
+    public:
+        // **Counting**
+        // Fitting arrangements; spaces in extra_empty are also forced empty.
+        static uint64_t count(const RolloutSearch::Observation& observation, Bitboard extra_empty = Bitboard(), ThreadPool* pool = nullptr);
+        // The total and, for every space, the arrangements with a ship on it, from one
+        // pass forward and one back over the same states.
+        static FleetCounts occupancy(const RolloutSearch::Observation& observation, ThreadPool* pool = nullptr);
+};
+
+#endif
@@ -0,0 +1,85 @@
+#include "FleetGenerator.h"
+
+#include "Enums.h"       // ShipType, FleetMode and ship lengths.
+#include "Bitboard.h"    // Space masks.
+#include "Placements.h"  // The placement table.
+#include "Random.h"      // Random draws.
+
+// **Legal Starts**
+// A space starts a legal placement when it and the next length - 1 spaces going E
+// (or S) are all clear. Runs going E must also start far enough from the J column
+// not to wrap onto the next row; runs going S fall off the bottom by themselves.
+Bitboard FleetGenerator::legalStarts(int length, Bitboard no_go, char direction) {
+    int step = direction == 'E' ? 1 : 10;
+    Bitboard clear = ~no_go;
+    Bitboard starts = clear;
+    for (int i = 1; i < length; ++i)
+        starts &= clear >> (i * step);
+    if (direction == 'E')
+        for (int column_index = 11 - length; column_index < 10; ++column_index)
+            starts &= ~Bitboard::column(column_index);
+    return starts;
+}
+
+// **Sequential Draw**
+// Each ship is uniform over the placements that still fit, so it never retries.
+bool FleetGenerator::draw_sequential(Random& rand_func, Fleet& fleet) {
+    Bitboard no_go;
+    for (ShipType ship_type : placementOrder) {
+        int length = Ships::lengthOf(ship_type);
+        Bitboard across = legalStarts(length, no_go, 'E');
+        Bitboard down = legalStarts(length, no_go, 'S');
+        int across_count = across.count();
+        int count = across_count + down.count();
+        if (count == 0)
+            return false; // Earlier ships left no room.
+        int pick = rand_func.below(count);
+        int start_index = pick < across_count ? across.select(pick) : down.select(pick - across_count);
+        const Placement& placement = Placements::at(length, static_cast<SpaceName>(start_index + 1), pick < across_count ? 'E' : 'S');
+        fleet.ships[ship_type] = placement;
+        fleet.occupancy |= placement.mask;
+        no_go |= placement.mask | placement.halo;
+    }
+    return true;
+}
+
+// **Sequential Chance**
+// The product, in placement order, of one over the placements each ship could have
+// taken given the ships before it.
+double FleetGenerator::sequentialChance(const array<Bitboard, 5>& ship_masks) {
+    double chance = 1.0;
+    Bitboard no_go;
+    for (ShipType ship_type : placementOrder) {
+        int length = Ships::lengthOf(ship_type);
+        chance /= legalStarts(length, no_go, 'E').count() + legalStarts(length, no_go, 'S').count();
+        no_go |= ship_masks[ship_type].spread();
+    }
+    return chance;
+}
+
+// **Uniform Draw**
+// Every combination of placements is equally likely to be drawn, and only the legal
+// ones are kept, so every legal fleet comes out equally often.
+bool FleetGenerator::draw_uniform(Random& rand_func, Fleet& fleet) {
+    Bitboard no_go;
+    for (ShipType ship_type : placementOrder) {
+        int length = Ships::lengthOf(ship_type);
+        const Placement& placement = Placements::begin(length)[rand_func.below(Placements::count(length))];
+        if (placement.mask.intersects(no_go))
+            return false; // Overlaps or touches an earlier ship.
+        fleet.ships[ship_type] = placement;
+        fleet.occupancy |= placement.mask;
+        no_go |= placement.mask | placement.halo;
+    }
+    return true;
+}
+
+// **Generate**
+// Repeats the draw until it yields a whole fleet.
+Fleet FleetGenerator::generate(Random& rand_func, FleetMode fleet_mode) {
+    for (;;) {
+        Fleet fleet;
+        if (fleet_mode == UNIFORM ? draw_uniform(rand_func, fleet) : draw_sequential(rand_func, fleet))
+            return fleet;
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef FLEETGENERATOR_H
+#define FLEETGENERATOR_H
+
+#include "Enums.h"       // ShipType and FleetMode.
+#include "Bitboard.h"    // Occupied and no-go spaces.
+#include "Placements.h"  // Every placement of every ship length.
+#include "Random.h"      // Draws the placements.
+
+#include <array>
+    using std::array;
+
+// **Fleet Struct**
+// One legal arrangement of all five ships, as placements indexed by ShipType.
+struct Fleet {
+    array<Placement, 5> ships;  // Placement of each ship, indexed by ShipType.
+    Bitboard occupancy;         // Spaces holding any ship.
+};
+
+// **FleetGenerator Class**
+// Draws random fleets straight from the placement table, tracking the spaces still
+// free as a mask, so no ship object, grid or string is touched until the fleet is done.
+//  - SEQUENTIAL picks each ship uniformly among the placements still legal (found
+//    for a whole row or column at once with shifts and ANDs), in the
+//    order autoSetShips uses, which is the distribution the game has always dealt.
+//    No placement is ever rejected; only the rare fleet whose last ships no longer
+//    fit is started over.
+//  - UNIFORM makes every legal fleet equally likely: each ship is drawn from all of
+//    its placements and the fleet is started over at the first clash.
+class FleetGenerator {
+    private:
+        inline static constexpr ShipType placementOrder[] = {CARRIER, BATTLESHIP, DESTROYER, SUBMARINE, CRUISER}; // Order used by autoSetShips.
+
+        static bool draw_sequential(Random& rand_func, Fleet& fleet); // One attempt; false on a dead end.
+        static bool draw_uniform(Random& rand_func, Fleet& fleet);    // One attempt; false on a clash.
+
+    public:
+        // **Generating Fleets**
+        static Fleet generate(Random& rand_func, FleetMode fleet_mode = SEQUENTIAL); // Draws one legal fleet.
+        static Bitboard legalStarts(int length, Bitboard no_go, char direction); // Start spaces of the E or S placements clear of no_go.
+        static double sequentialChance(const array<Bitboard, 5>& ship_masks); // Chance SEQUENTIAL deals these ships, indexed by ShipType.
+};
+
+#endif
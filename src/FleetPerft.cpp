@@ -0,0 +1,193 @@
+#include "FleetPerft.h"
+
+#include "Enums.h"          // Ship types, lengths and space parsing.
+#include "Bitboard.h"       // Masks.
+#include "Placements.h"     // Placement masks and halos.
+#include "FleetGenerator.h" // Legal start masks.
+#include "ThreadPool.h"     // Workers.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <string>
+    using std::string;
+
+#include <utility>
+    using std::pair;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+    using std::chrono::duration;
+
+#include <stdexcept>
+    using std::invalid_argument;
+
+// Ships in the order they are laid: longest first, so the tree narrows early.
+static constexpr ShipType LAYING_ORDER[] = {CARRIER, BATTLESHIP, SUBMARINE, DESTROYER, CRUISER};
+
+// Names the parser accepts, indexed by ShipType.
+static constexpr const char* SHIP_NAMES[] = {"carrier", "battleship", "submarine", "destroyer", "cruiser"};
+
+// **Walking the Tree**
+// The lengths still to lay, in laying order, and the totals of one walk.
+struct PerftWalk {
+    array<int, 5> lengths {};
+    int numShips {0};
+    uint64_t arrangements {0};
+    uint64_t nodes {0};
+
+    // Lays ships depth onwards around no_go; the last is counted from its start masks.
+    void descend(Bitboard no_go, int depth) {
+        int length = this->lengths[depth];
+        Bitboard across = FleetGenerator::legalStarts(length, no_go, 'E');
+        Bitboard down = FleetGenerator::legalStarts(length, no_go, 'S');
+        if (depth + 1 == this->numShips) {
+            uint64_t leaves = static_cast<uint64_t>(across.count() + down.count());
+            this->arrangements += leaves;
+            this->nodes += leaves;
+            return;
+        }
+        for (char direction : {'E', 'S'}) {
+            Bitboard starts = direction == 'E' ? across : down;
+            while (starts.any()) {
+                const Placement& placement = Placements::at(length, static_cast<SpaceName>(starts.popLowest() + 1), direction);
+                ++this->nodes;
+                this->descend(no_go | placement.mask | placement.halo, depth + 1);
+            }
+        }
+    }
+};
+
+// **Splitting the Tree**
+// The no-go masks of every node at depth, walked breadth first; nodes counts the ships laid.
+static vector<Bitboard> expand(const vector<Bitboard>& frontier, int length, uint64_t& nodes) {
+    vector<Bitboard> next;
+    for (Bitboard no_go : frontier) {
+        for (char direction : {'E', 'S'}) {
+            Bitboard starts = FleetGenerator::legalStarts(length, no_go, direction);
+            while (starts.any()) {
+                const Placement& placement = Placements::at(length, static_cast<SpaceName>(starts.popLowest() + 1), direction);
+                next.push_back(no_go | placement.mask | placement.halo);
+            }
+        }
+    }
+    nodes += next.size();
+    return next;
+}
+
+// **Count**
+// Without a pool, or with too few ships to split, the whole tree is one walk. With
+// one, the top is expanded level by level until there are enough subtrees, and the
+// workers claim them one at a time from the pool's shared counter.
+PerftResult FleetPerft::count(const PerftBoard& board, ThreadPool* pool) {
+    steady_clock::time_point start_time = steady_clock::now();
+    if (!isLegal(board))
+        throw invalid_argument("The laid ships break the placement rules.");
+    PerftResult result;
+    PerftWalk walk;
+    Bitboard no_go = board.blocked;
+    for (ShipType ship_type : LAYING_ORDER) {
+        if (board.placed[ship_type].any())
+            no_go |= board.placed[ship_type].spread();
+        else
+            walk.lengths[walk.numShips++] = Ships::lengthOf(ship_type);
+    }
+
+    if (walk.numShips == 0) {
+        result.arrangements = 1;
+    } else if (pool == nullptr || walk.numShips == 1) {
+        walk.descend(no_go, 0);
+        result.arrangements = walk.arrangements;
+        result.nodes = walk.nodes;
+        result.tasks = 1;
+    } else {
+        vector<Bitboard> tasks {no_go};
+        int depth = 0;
+        while (depth + 1 < walk.numShips && tasks.size() < TASKS_PER_WORKER * pool->size())
+            tasks = expand(tasks, walk.lengths[depth++], result.nodes);
+        vector<PerftWalk> walks(pool->size(), walk);
+        pool->parallelFor(tasks.size(), 1, [&](size_t worker, size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j)
+                walks[worker].descend(tasks[j], depth);
+        });
+        for (const PerftWalk& done : walks) {
+            result.arrangements += done.arrangements;
+            result.nodes += done.nodes;
+        }
+        result.tasks = tasks.size();
+    }
+    result.seconds = duration<double>(steady_clock::now() - start_time).count();
+    return result;
+}
+
+// **Divide**
+vector<pair<Placement, uint64_t>> FleetPerft::divide(const PerftBoard& board, ThreadPool* pool) {
+    vector<pair<Placement, uint64_t>> counts;
+    if (!isLegal(board))
+        throw invalid_argument("The laid ships break the placement rules.");
+    Bitboard no_go = board.blocked;
+    for (Bitboard ship_mask : board.placed)
+        no_go |= ship_mask.spread();
+    for (ShipType ship_type : LAYING_ORDER) {
+        if (board.placed[ship_type].any())
+            continue;
+        int length = Ships::lengthOf(ship_type);
+        for (char direction : {'E', 'S'}) {
+            Bitboard starts = FleetGenerator::legalStarts(length, no_go, direction);
+            while (starts.any()) {
+                const Placement& placement = Placements::at(length, static_cast<SpaceName>(starts.popLowest() + 1), direction);
+                PerftBoard child = board;
+                child.placed[ship_type] = placement.mask;
+                counts.emplace_back(placement, count(child, pool).arrangements);
+            }
+        }
+        break;
+    }
+    return counts;
+}
+
+// **Parse**
+PerftBoard FleetPerft::parse(const vector<string>& tokens) {
+    PerftBoard board;
+    for (const string& token : tokens) {
+        size_t colon = token.find(':');
+        if (colon == string::npos)
+            throw invalid_argument("Bad argument: " + token);
+        string name = token.substr(0, colon);
+        string where = token.substr(colon + 1);
+        if (name == "miss") {
+            SpaceName space_name = Spaces::parse(where);
+            if (space_name == NO_SPACE)
+                throw invalid_argument("Bad argument: " + token);
+            board.blocked |= Bitboard::of(space_name);
+            continue;
+        }
+        int ship_type = 0;
+        while (ship_type < 5 && name != SHIP_NAMES[ship_type])
+            ++ship_type;
+        SpaceName start = where.empty() ? NO_SPACE : Spaces::parse(where.substr(0, where.size() - 1));
+        if (ship_type == 5 || start == NO_SPACE || Placements::directionIndex(where.back()) < 0)
+            throw invalid_argument("Bad argument: " + token);
+        const Placement& placement = Placements::at(Ships::lengthOf(static_cast<ShipType>(ship_type)), start, where.back());
+        if (!placement.fits())
+            throw invalid_argument("Off the grid: " + token);
+        if (board.placed[ship_type].any())
+            throw invalid_argument("Laid twice: " + token);
+        board.placed[ship_type] = placement.mask;
+    }
+    return board;
+}
+
+// **Legal**
+bool FleetPerft::isLegal(const PerftBoard& board) {
+    Bitboard no_go = board.blocked;
+    for (Bitboard ship_mask : board.placed) {
+        if (ship_mask.intersects(no_go))
+            return false;
+        no_go |= ship_mask.spread();
+    }
+    return true;
+}
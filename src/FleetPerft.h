@@ -0,0 +1,68 @@
+#ifndef FLEETPERFT_H
+#define FLEETPERFT_H
+
+#include "Enums.h"      // Ship types.
+#include "Bitboard.h"   // Ships and blocked spaces as sets.
+#include "Placements.h" // Every placement of every ship length.
+#include "ThreadPool.h" // Workers for the subtrees.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <string>
+    using std::string;
+
+#include <utility>
+    using std::pair;
+
+#include <cstdint>
+    using std::uint64_t;
+
+// **PerftBoard Struct**
+// A board to count from: the ships already laid and the spaces no ship may cover.
+struct PerftBoard {
+    array<Bitboard, 5> placed {}; // Spaces of each ship laid so far, indexed by ShipType; empty while it is still to lay.
+    Bitboard blocked;             // Spaces no ship may cover, such as misses.
+};
+
+// **PerftResult Struct**
+struct PerftResult {
+    uint64_t arrangements {0}; // Legal ways to lay the ships still to lay.
+    uint64_t nodes {0};        // Ships laid while walking the tree, the last ship of each arrangement included.
+    uint64_t tasks {0};        // Subtrees handed to the workers.
+    double seconds {0.0};      // Wall-clock time of the count.
+
+    double nodesPerSecond() const { return this->seconds > 0.0 ? static_cast<double>(this->nodes) / this->seconds : 0.0; }
+};
+
+// **FleetPerft Class**
+// Counts every legal fleet by walking the tree of placements, the way chess perft
+// counts positions: the same answer every run, and a speed that any change to the
+// placement masks shows up in. Ships are laid longest first, each at the starts
+// FleetGenerator::legalStarts leaves clear of the ships before it, their halos (the
+// no-touch rule of placeOnGrid) and the blocked spaces; the last ship is counted
+// from the two start masks without being laid. The top of the tree is split into
+// at least TASKS_PER_WORKER subtrees per worker, which the pool's workers claim one
+// at a time, so a worker stuck in a crowded subtree never holds the others up.
+class FleetPerft {
+    private:
+        static constexpr uint64_t TASKS_PER_WORKER = 64; // Subtrees per worker the top of the tree is split into.
+
+    public:
+        // **Counting**
+        // Arrangements of the ships still to lay on board. Throws if the laid ships break the rules.
+        static PerftResult count(const PerftBoard& board, ThreadPool* pool = nullptr);
+        // The count under each placement of the longest ship still to lay, like perft's divide.
+        static vector<pair<Placement, uint64_t>> divide(const PerftBoard& board, ThreadPool* pool = nullptr);
+
+        // **Boards**
+        // Reads tokens such as "carrier:A1E" (a ship, its first space and N, S, E or W)
+        // and "miss:B7". Throws if a token is malformed or a ship is laid twice.
+        static PerftBoard parse(const vector<string>& tokens);
+        static bool isLegal(const PerftBoard& board); // The laid ships keep off the blocked spaces and each other's halos.
+};
+
+#endif
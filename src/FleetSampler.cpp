@@ -0,0 +1,257 @@
+#include "FleetSampler.h"
+
+#include "Enums.h"          // Ship types, lengths and fleet modes.
+#include "Bitboard.h"       // Masks.
+#include "Heatmap.h"        // Placements still legal.
+#include "FleetGenerator.h" // Sequential odds.
+#include "Placements.h"     // Placement masks.
+#include "Random.h"         // Chain moves.
+#include "RolloutSearch.h"  // Observations and first fleets.
+
+#include <array>
+    using std::array;
+
+#include <algorithm>
+    using std::min;
+
+#include <cmath>
+    using std::sqrt;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+    using std::chrono::duration;
+
+#include <stdexcept>
+    using std::runtime_error;
+
+// Draws of RolloutSearch::sampleFleet tried before the chain gives up on starting.
+static constexpr int START_ATTEMPTS = 64;
+
+// **Constructor**
+FleetSampler::FleetSampler(const Heatmap& the_heatmap, const RolloutSearch::Observation& the_observation, FleetMode the_target)
+    : heatmap{the_heatmap}, observation{the_observation}, target{the_target} {}
+
+// **Sequential Odds**
+double FleetSampler::sequential_chance(const array<Bitboard, 5>& afloat_ships) const {
+    array<Bitboard, 5> by_type = this->observation.sunkShips;
+    for (int k = 0; k < this->observation.numAfloat; ++k)
+        by_type[this->observation.afloat[k]] = afloat_ships[k];
+    return FleetGenerator::sequentialChance(by_type);
+}
+
+// **Start**
+// Any fitting fleet will do, since the chain forgets where it began.
+bool FleetSampler::start(Random& rand_func) {
+    for (int attempt = 0; attempt < START_ATTEMPTS; ++attempt) {
+        if (RolloutSearch::sampleFleet(this->heatmap, this->observation, rand_func, this->ships) > 0.0) {
+            this->chance = this->sequential_chance(this->ships);
+            this->started = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// **Step**
+// Half the moves lift one ship and lay it again among the placements that keep
+// clear of the others and cover the hits only it can explain. The current placement
+// is always among them, so the move never fails; for SEQUENTIAL it is kept with
+// probability min(1, new odds / old odds), as the proposal is symmetric. One ship
+// alone can never hand a hit over to another, though, so the other half lift two.
+bool FleetSampler::step(Random& rand_func) {
+    int num_afloat = this->observation.numAfloat;
+    if (num_afloat == 0)
+        return false;
+    if (num_afloat > 1 && rand_func.below(2) == 0)
+        return this->step_pair(rand_func);
+    int k = rand_func.below(num_afloat);
+    Bitboard unresolved = this->observation.hits & ~this->observation.sunk;
+    Bitboard others;
+    for (int j = 0; j < num_afloat; ++j)
+        if (j != k)
+            others |= this->ships[j];
+    Bitboard blocked = others.spread();
+    Bitboard must = unresolved & ~others;
+
+    const Placement* chosen = nullptr;
+    int seen = 0;
+    for (const Placement& placement : this->heatmap.viewPlacements(Ships::lengthOf(this->observation.afloat[k])))
+        if (!placement.mask.intersects(blocked) && (must & ~placement.mask).none() && (placement.mask & ~unresolved).any() && rand_func.below(++seen) == 0)
+            chosen = &placement;
+    if (chosen == nullptr || chosen->mask == this->ships[k])
+        return false;
+
+    if (this->target == SEQUENTIAL) {
+        array<Bitboard, 5> proposal = this->ships;
+        proposal[k] = chosen->mask;
+        double proposal_chance = this->sequential_chance(proposal);
+        double uniform = static_cast<double>(rand_func.next() >> 11) * 0x1.0p-53;
+        if (uniform * this->chance >= proposal_chance)
+            return false;
+        this->chance = proposal_chance;
+    }
+    this->ships[k] = chosen->mask;
+    return true;
+}
+
+// **Pair Step**
+// Lifts ships k and l, lays k anywhere clear of the rest, then l among the
+// placements clear of k that cover the hits left over. Going back draws the old k
+// from the same set, so the move is kept with probability min(1, ways for l now /
+// ways for l before), times the odds ratio for SEQUENTIAL.
+bool FleetSampler::step_pair(Random& rand_func) {
+    int num_afloat = this->observation.numAfloat;
+    int k = rand_func.below(num_afloat);
+    int l = rand_func.below(num_afloat - 1);
+    if (l >= k)
+        ++l;
+    Bitboard unresolved = this->observation.hits & ~this->observation.sunk;
+    Bitboard others;
+    for (int j = 0; j < num_afloat; ++j)
+        if (j != k && j != l)
+            others |= this->ships[j];
+    Bitboard blocked = others.spread();
+    Bitboard must = unresolved & ~others;
+
+    const Placement* first = nullptr;
+    int seen = 0;
+    for (const Placement& placement : this->heatmap.viewPlacements(Ships::lengthOf(this->observation.afloat[k])))
+        if (!placement.mask.intersects(blocked) && (placement.mask & ~unresolved).any() && rand_func.below(++seen) == 0)
+            first = &placement;
+    if (first == nullptr || first->mask == this->ships[k])
+        return false;
+
+    // Placements of l that go with k at k_mask; chosen, if given, gets one at random.
+    View<Placement> second_placements = this->heatmap.viewPlacements(Ships::lengthOf(this->observation.afloat[l]));
+    auto ways_for_second = [&](Bitboard k_mask, const Placement** chosen) {
+        Bitboard second_blocked = blocked | k_mask.spread();
+        Bitboard second_must = must & ~k_mask;
+        int ways = 0;
+        for (const Placement& placement : second_placements) {
+            if (placement.mask.intersects(second_blocked) || (second_must & ~placement.mask).any() || (placement.mask & ~unresolved).none())
+                continue;
+            ++ways;
+            if (chosen != nullptr && rand_func.below(ways) == 0)
+                *chosen = &placement;
+        }
+        return ways;
+    };
+    const Placement* second = nullptr;
+    int ways_now = ways_for_second(first->mask, &second);
+    if (ways_now == 0)
+        return false;
+    int ways_before = ways_for_second(this->ships[k], nullptr);
+
+    array<Bitboard, 5> proposal = this->ships;
+    proposal[k] = first->mask;
+    proposal[l] = second->mask;
+    double proposal_chance = this->target == SEQUENTIAL ? this->sequential_chance(proposal) : 1.0;
+    double current_chance = this->target == SEQUENTIAL ? this->chance : 1.0;
+    double uniform = static_cast<double>(rand_func.next() >> 11) * 0x1.0p-53;
+    if (uniform * current_chance * ways_before >= proposal_chance * ways_now)
+        return false;
+    if (this->target == SEQUENTIAL)
+        this->chance = proposal_chance;
+    this->ships = proposal;
+    return true;
+}
+
+// **Run**
+// Effective sample size by batch means: the samples are cut into about sqrt(n)
+// batches, and for each space the spread of the batch means is set against what
+// independent samples of the same occupancy would give.
+FleetSampler::Stats FleetSampler::run(long num_samples, int thin, int burn_in, Random& rand_func, array<long, 100>& occupancy) {
+    steady_clock::time_point start_time = steady_clock::now();
+    if (!this->started && !this->start(rand_func))
+        throw runtime_error("No fleet fits the observations.");
+    Stats stats;
+    int sweep = this->observation.numAfloat;
+    for (long s = 0; s < static_cast<long>(burn_in) * sweep; ++s)
+        stats.moved += this->step(rand_func);
+    stats.steps += static_cast<long>(burn_in) * sweep;
+
+    long batch_size = static_cast<long>(sqrt(static_cast<double>(num_samples)));
+    if (batch_size < 1)
+        batch_size = 1;
+    long num_batches = 0;
+    array<long, 100> batch_counts {};
+    array<double, 100> mean_sums {};
+    array<double, 100> square_sums {};
+    for (long sample = 0; sample < num_samples; ++sample) {
+        for (long s = 0; s < static_cast<long>(thin) * sweep; ++s)
+            stats.moved += this->step(rand_func);
+        stats.steps += static_cast<long>(thin) * sweep;
+        Bitboard spaces = this->getOccupancy();
+        while (spaces.any()) {
+            int i = spaces.popLowest();
+            ++occupancy[i];
+            ++batch_counts[i];
+        }
+        ++stats.samples;
+        if (stats.samples % batch_size == 0) {
+            for (int i = 0; i < 100; ++i) {
+                double mean = static_cast<double>(batch_counts[i]) / static_cast<double>(batch_size);
+                mean_sums[i] += mean;
+                square_sums[i] += mean * mean;
+            }
+            batch_counts.fill(0);
+            ++num_batches;
+        }
+    }
+
+    long used = num_batches * batch_size;
+    stats.effectiveSamples = static_cast<double>(used);
+    if (num_batches > 1) {
+        for (int i = 0; i < 100; ++i) {
+            double p = mean_sums[i] / static_cast<double>(num_batches);
+            double spread = (square_sums[i] - static_cast<double>(num_batches) * p * p) / static_cast<double>(num_batches - 1);
+            if (p <= 0.0 || p >= 1.0 || spread <= 0.0)
+                continue; // Always or never occupied, or no batch differed: nothing to mix.
+            stats.effectiveSamples = min(stats.effectiveSamples, static_cast<double>(num_batches) * p * (1.0 - p) / spread);
+        }
+    }
+    stats.seconds = duration<double>(steady_clock::now() - start_time).count();
+    return stats;
+}
+
+// **Occupancy**
+Bitboard FleetSampler::getOccupancy() const {
+    Bitboard spaces;
+    for (int k = 0; k < this->observation.numAfloat; ++k)
+        spaces |= this->ships[k];
+    return spaces;
+}
+
+// **Observe a Fleet**
+RolloutSearch::Observation FleetSampler::observe(const Fleet& fleet, Bitboard shots) {
+    RolloutSearch::Observation seen;
+    seen.hits = shots & fleet.occupancy;
+    seen.targeted = shots;
+    for (ShipType ship_type : {CARRIER, BATTLESHIP, SUBMARINE, DESTROYER, CRUISER}) {
+        Bitboard ship_mask = fleet.ships[ship_type].mask;
+        if ((ship_mask & ~shots).none()) {
+            seen.sunkShips[ship_type] = ship_mask;
+            seen.sunk |= ship_mask;
+        } else {
+            seen.afloat[seen.numAfloat++] = ship_type;
+        }
+    }
+    return seen;
+}
+
+// **Fits**
+// Every hit is on a ship, no ship lies on a miss, on or next to a sunk ship, or next
+// to another, and no afloat ship is hit everywhere (it would have been announced sunk).
+bool FleetSampler::fits(const RolloutSearch::Observation& observation, const array<Bitboard, 5>& afloat_ships) {
+    Bitboard misses = observation.targeted & ~observation.hits;
+    Bitboard blocked = misses | observation.sunk.spread();
+    Bitboard covered = observation.sunk;
+    for (int k = 0; k < observation.numAfloat; ++k) {
+        Bitboard ship_mask = afloat_ships[k];
+        if (ship_mask.count() != Ships::lengthOf(observation.afloat[k]) || ship_mask.intersects(blocked) || (ship_mask & ~observation.hits).none())
+            return false;
+        blocked |= ship_mask.spread();
+        covered |= ship_mask;
+    }
+    return (observation.hits & ~covered).none();
+}
@@ -0,0 +1,72 @@
+#ifndef FLEETSAMPLER_H
+#define FLEETSAMPLER_H
+
+#include "Enums.h"          // Ship types and fleet modes.
+#include "Bitboard.h"       // Observations and ships as sets of spaces.
+#include "Heatmap.h"        // Placements still legal.
+#include "FleetGenerator.h" // Fleets and the sequential draw's odds.
+#include "Random.h"         // Chain moves.
+#include "RolloutSearch.h"  // What the shooter has observed.
+
+#include <array>
+    using std::array;
+
+// **FleetSampler Class**
+// A Markov chain over the fleets of the ships still afloat that fit everything
+// the shooter has seen. It starts from one fitting fleet and moves one ship at a
+// time: the ship is lifted and laid again, uniformly among the heatmap's legal
+// placements that keep clear of the other ships and their halos (the no-touch rule
+// of Grid::neighborSpaces) and still cover every unresolved hit. That is a Gibbs
+// step for the UNIFORM fleet distribution; for SEQUENTIAL (how the game deals
+// fleets) the new placement is kept with the Metropolis odds of the two fleets.
+// Every other move lifts two ships at once, so a hit can pass from one ship to
+// another, which no single-ship move allows. A move costs one to three passes over
+// one length's placements however many shots have been fired, where rejection
+// sampling from FleetGenerator almost never fits once a dozen shots are in.
+class FleetSampler {
+    public:
+        // **Run Statistics**
+        struct Stats {
+            long samples {0};              // Fleets read off the chain.
+            long steps {0};                // Moves made.
+            long moved {0};                // Moves that put a ship somewhere new.
+            double seconds {0.0};          // Wall-clock time of the run.
+            double effectiveSamples {0.0}; // Least effective sample size over the spaces whose occupancy varied.
+
+            double samplesPerSecond() const { return this->seconds > 0.0 ? static_cast<double>(this->samples) / this->seconds : 0.0; }
+        };
+
+    private:
+        const Heatmap& heatmap;                     // Legal placements; must hold the observations.
+        const RolloutSearch::Observation& observation;
+        FleetMode target;                           // Fleet distribution the chain samples.
+        array<Bitboard, 5> ships {};                // Current placement of each afloat ship, indexed like observation.afloat.
+        double chance {0.0};                        // Sequential odds of the current fleet (SEQUENTIAL only).
+        bool started {false};
+
+        double sequential_chance(const array<Bitboard, 5>& afloat_ships) const; // Odds of the fleet with the sunk ships.
+        bool step_pair(Random& rand_func);                                       // Moves two random ships together.
+
+    public:
+        // **Constructor**
+        FleetSampler(const Heatmap& the_heatmap, const RolloutSearch::Observation& the_observation, FleetMode the_target = SEQUENTIAL);
+
+        // **Running the Chain**
+        bool start(Random& rand_func); // Finds a first fitting fleet; false if none turned up.
+        bool step(Random& rand_func);  // Moves one or two random ships, true if it went somewhere new; start must have succeeded.
+        // Collects num_samples fleets, one every thin sweeps over the afloat ships, after
+        // burn_in sweeps, adding each fleet's spaces to occupancy. Throws if no fleet fits.
+        Stats run(long num_samples, int thin, int burn_in, Random& rand_func, array<long, 100>& occupancy);
+
+        // **Fleets**
+        const array<Bitboard, 5>& getShips() const { return this->ships; } // Indexed like observation.afloat.
+        Bitboard getOccupancy() const;                                  // Spaces of the afloat ships.
+
+        // **Observations**
+        // What a shooter who fired at shots knows about fleet.
+        static RolloutSearch::Observation observe(const Fleet& fleet, Bitboard shots);
+        // True if the afloat ships, indexed like observation.afloat, agree with every observation.
+        static bool fits(const RolloutSearch::Observation& observation, const array<Bitboard, 5>& afloat_ships);
+};
+
+#endif
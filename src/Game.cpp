@@ -30,22 +30,35 @@ Game::Game(string human_name) {
 
 // **Game Setup Constructor**
 // Initializes players, sets up the game, and starts gameplay.
-Game::Game(string human_name, int(*rand_func)()) : Game(human_name) {
+Game::Game(string human_name, Random& rand_func) : Game(human_name) {
     this->doSetUp(rand_func);     // Set up the game (place ships).
     this->doCoinToss(rand_func);  // Decide who goes first with a coin toss.
     this->doFinalSetup();         // Finalize setup (link players and AI).
     this->playGame(rand_func);    // Start the game loop.
 }
 
+// **Headless Constructor**
+// Creates two CPU-driven players for a simulated game. Nothing is printed, read or slept on.
+// With an arena, players, grids, ships and AIs all live in its block; the caller
+// resets the arena once the game is destroyed.
+Game::Game(CamdenType rival_type, CamdenType camden_type, Arena* the_arena) : camdenType{camden_type}, rivalType{rival_type}, isHeadless{true}, arena{the_arena} {
+    this->cpu = Arena::make<Player>(this->arena, CPU, this->arena);
+    this->human = Arena::make<Player>(this->arena, MAN, "Rival", this->arena);
+    this->cpu->setQuiet(true);
+    this->human->setQuiet(true);
+}
+
 // **Destructor**
 // Frees dynamically allocated memory for players and the AI.
 Game::~Game() {
-    delete this->human;  // Free memory for the human player.
+    Arena::destroy(this->arena, this->human);  // Free memory for the human player.
     this->human = nullptr;
-    delete this->cpu;    // Free memory for the CPU player.
+    Arena::destroy(this->arena, this->cpu);    // Free memory for the CPU player.
     this->cpu = nullptr;
-    delete this->camden; // Free memory for the AI logic.
+    Arena::destroy(this->arena, this->camden); // Free memory for the AI logic.
     this->camden = nullptr;
+    Arena::destroy(this->arena, this->rival);  // Free memory for the rival AI, if any.
+    this->rival = nullptr;
 }
 
 // **Getter for Human Player**
@@ -63,11 +76,26 @@ Camden* Game::getCamden() const {
     return this->camden;
 }
 
+// **Getter for Rival AI**
+Camden* Game::getRival() const {
+    return this->rival;
+}
+
+// **Getter for Headless Flag**
+bool Game::getIsHeadless() const {
+    return this->isHeadless;
+}
+
 // **Getter for Current Turn**
 PlayerType Game::getTurn() const {
     return this->turn;
 }
 
+// **Getter for First Turn**
+PlayerType Game::getFirstTurn() const {
+    return this->firstTurn;
+}
+
 // **Setter for Human Player**
 void Game::setHuman(Player* the_human) {
     this->human = the_human;
@@ -88,6 +116,29 @@ void Game::setTurn(PlayerType the_turn) {
     this->turn = the_turn;
 }
 
+// **Setter for Camden's Prior**
+void Game::setCamdenPrior(const PlacementPrior* prior) {
+    this->camdenPrior = prior;
+    if(this->camden != nullptr)
+        this->camden->setPrior(prior);
+}
+
+// **Setter for Camden's Search Budget**
+void Game::setCamdenBudget(const SearchBudget& budget) {
+    this->camdenBudget = budget;
+    if(this->camden != nullptr)
+        this->camden->setSearchBudget(budget);
+}
+
+// **Setter for the Heatmap Cache**
+void Game::setHeatmapCache(HeatmapCache* heatmap_cache) {
+    this->heatmapCache = heatmap_cache;
+    if(this->camden != nullptr)
+        this->camden->setHeatmapCache(heatmap_cache);
+    if(this->rival != nullptr)
+        this->rival->setHeatmapCache(heatmap_cache);
+}
+
 // **Check if Someone has Won**
 // Determines if either player has sunk all opponent ships.
 bool Game::someoneHasWon() const {
@@ -119,19 +170,31 @@ void Game::switchTurn() {
     }
 }
 
-// **CPU Turn Logic**
-// Executes the CPU's turn using AI logic.
-void Game::doCpuTurn(int(*rand_func)()) const {
-    string bad_space = "NA"; // Placeholder for invalid spaces.
+// **AI Turn Logic**
+// Asks an AI for spaces until its player accepts one.
+void Game::do_ai_turn(Camden* ai, Player* shooter, Random& rand_func) const {
+    SpaceName bad_space = NO_SPACE; // No rejected space yet.
     bool good_space_chosen = false;
-    string camden_space;
+    SpaceName ai_space;
     do {
-        camden_space = this->camden->makeMove(rand_func, bad_space); // AI chooses a space.
-        good_space_chosen = this->cpu->target(camden_space, false);  // Try targeting that space.
-        if(!good_space_chosen) bad_space = camden_space;            // Retry if the space was invalid.
+        ai_space = ai->makeMove(rand_func, bad_space);        // AI chooses a space.
+        good_space_chosen = shooter->target(ai_space, false); // Try targeting that space.
+        if(!good_space_chosen) bad_space = ai_space;          // Retry if the space was invalid.
     } while (!good_space_chosen);
 }
 
+// **CPU Turn Logic**
+// Executes the CPU's turn using AI logic.
+void Game::doCpuTurn(Random& rand_func) const {
+    this->do_ai_turn(this->camden, this->cpu, rand_func);
+}
+
+// **Rival Turn Logic**
+// Plays the human's seat with the rival AI in headless games.
+void Game::doRivalTurn(Random& rand_func) const {
+    this->do_ai_turn(this->rival, this->human, rand_func);
+}
+
 // **Human Turn Logic**
 // Prompts the human player to make their move.
 void Game::doHumanTurn() const {
@@ -140,9 +203,11 @@ void Game::doHumanTurn() const {
 
 // **Execute a Turn**
 // Executes a turn for the current player and switches turns.
-void Game::doTurn(int(*rand_func)()) {
+void Game::doTurn(Random& rand_func) {
     if(this->turn == CPU)
         this->doCpuTurn(rand_func); // CPU's turn.
+    else if(this->turn == MAN && this->isHeadless)
+        this->doRivalTurn(rand_func); // Rival AI's turn in the human's seat.
     else if(this->turn == MAN)
         this->doHumanTurn(); // Human's turn.
     else
@@ -152,7 +217,12 @@ void Game::doTurn(int(*rand_func)()) {
 
 // **Game Setup**
 // Allows the human to place ships and auto-places ships for the CPU.
-void Game::doSetUp(int(*rand_func)()) {
+void Game::doSetUp(Random& rand_func) {
+    if(this->isHeadless) {
+        this->human->autoSetShips(rand_func); // Both seats place their ships at random.
+        this->cpu->autoSetShips(rand_func);
+        return;
+    }
     this->human->askToSetShips(rand_func); // Human sets their ships.
     cout << "\nCamden is setting his ships..." << endl;
     this->cpu->autoSetShips(rand_func); // CPU's ships are auto-placed.
@@ -161,7 +231,12 @@ void Game::doSetUp(int(*rand_func)()) {
 }
 
 // **Coin Toss to Decide First Turn**
-void Game::doCoinToss(int(*rand_func)()) {
+void Game::doCoinToss(Random& rand_func) {
+    if(this->isHeadless) {
+        this->turn = rand_func() % 2 ? MAN : CPU; // Nobody to ask; the toss alone decides.
+        this->firstTurn = this->turn;
+        return;
+    }
     char user_coin_choice;
     cout << "" << endl;
     cout << "Coin toss! Winner goes first. Heads or Tails?" << endl;
@@ -182,8 +257,10 @@ void Game::doCoinToss(int(*rand_func)()) {
             this->turn = MAN;
         } else {
             cout << "It\'s Tails, you lost the toss and will go second." << endl;
+            this->turn = CPU;
         }
     }
+    this->firstTurn = this->turn;
     sleep(1);
     cout << "" << endl;
     cout << "Loading Game..." << endl;
@@ -196,12 +273,27 @@ void Game::doCoinToss(int(*rand_func)()) {
 void Game::doFinalSetup() {
     this->human->makeFoe(this->cpu); // Set CPU as human's foe.
     this->cpu->makeFoe(this->human); // Set human as CPU's foe.
-    this->camden = new Camden(this->cpu); // Initialize AI for CPU.
+    if(this->camden == nullptr) {
+        this->camden = Arena::make<Camden>(this->arena, this->cpu, this->camdenType); // Initialize AI for CPU.
+        this->camden->setPrior(this->camdenPrior);
+        this->camden->setSearchBudget(this->camdenBudget);
+        this->camden->setHeatmapCache(this->heatmapCache);
+    }
+    if(this->isHeadless && this->rival == nullptr) {
+        this->rival = Arena::make<Camden>(this->arena, this->human, this->rivalType); // Initialize AI for the human's seat.
+        this->rival->setHeatmapCache(this->heatmapCache);
+    }
 }
 
 // **Game Loop**
 // Runs the main game loop until there is a winner.
-void Game::playGame(int(*rand_func)()){
+void Game::playGame(Random& rand_func){
+    if(this->isHeadless) {
+        do {
+            this->doTurn(rand_func); // No pacing, no output.
+        } while (!(this->someoneHasWon()));
+        return;
+    }
     do {
         cout << "" << endl;
         this->doTurn(rand_func); // Execute a turn.
@@ -222,3 +314,25 @@ void Game::playGame(int(*rand_func)()){
         } else cout << "You win!" << endl;
     }
 }
+
+// **Headless Game**
+// Runs setup, coin toss and the game loop back to back for a simulated game.
+void Game::playHeadlessGame(Random& rand_func) {
+    this->doSetUp(rand_func);
+    this->doCoinToss(rand_func);
+    this->doFinalSetup();
+    this->playGame(rand_func);
+}
+
+// **Reset**
+// Empties both players' grids and shot lists and makes the AIs forget the last game,
+// keeping every object and the capacity of every list. Setup and the coin toss of
+// the next game then run on the same objects, so back-to-back games allocate nothing.
+void Game::reset() {
+    this->human->reset();
+    this->cpu->reset();
+    if(this->camden != nullptr)
+        this->camden->reset(); // Kept by doFinalSetup for the next game.
+    if(this->rival != nullptr)
+        this->rival->reset();
+}
@@ -4,6 +4,10 @@
 #include "Enums.h"   // Includes necessary enumerations (e.g., PlayerType).
 #include "Player.h"  // Defines the Player class for human and CPU.
 #include "Camden.h"  // Defines the AI logic for the CPU.
+#include "Random.h"  // Random number engine passed through setup and turns.
+#include "Arena.h"   // Optional per-game allocator.
+#include "PlacementPrior.h" // Optional hunting weights for Camden.
+#include "HeatmapCache.h" // Optional weights shared between games.
 
 #include <string>
     using std::string;
@@ -15,26 +19,44 @@ class Game {
         Player* human {nullptr};   // Pointer to the human player.
         Player* cpu {nullptr};     // Pointer to the CPU player.
         Camden* camden {nullptr};  // AI logic for the CPU player.
+        Camden* rival {nullptr};   // AI playing the human's seat in headless games.
         PlayerType turn;           // Indicates whose turn it is (MAN or CPU).
+        PlayerType firstTurn {MAN}; // Who won the coin toss and fired first.
+        CamdenType camdenType {EASY}; // Strategy of the CPU player's AI.
+        CamdenType rivalType {EASY};  // Strategy of the AI in the human's seat (headless only).
+        bool isHeadless {false};   // True for CPU-vs-CPU games with no console I/O or delays.
+        Arena* arena {nullptr};    // Allocator of every object of the game, or nullptr for the heap.
+        const PlacementPrior* camdenPrior {nullptr}; // Handed to Camden when it is made, or nullptr for none.
+        SearchBudget camdenBudget;  // Handed to Camden when it is made (ROLLOUT only).
+        HeatmapCache* heatmapCache {nullptr}; // Handed to both AIs when they are made, or nullptr for none.
+
+        void do_ai_turn(Camden* ai, Player* shooter, Random& rand_func) const; // Lets an AI fire one accepted shot.
 
     public:
         // **Constructors and Destructor**
         Game();                               // Default constructor.
         explicit Game(string human_name);     // Constructor to initialize players with a human's name.
-        Game(string human_name, int(*rand_func)()); // Full constructor that sets up and starts the game.
+        Game(string human_name, Random& rand_func); // Full constructor that sets up and starts the game.
+        Game(CamdenType rival_type, CamdenType camden_type, Arena* the_arena = nullptr); // Headless CPU-vs-CPU game; start it with playHeadlessGame.
         ~Game();                              // Destructor to clean up dynamically allocated memory.
 
         // **Getter Methods**
         Player* getHuman() const;             // Returns a pointer to the human player.
         Player* getCpu() const;               // Returns a pointer to the CPU player.
         Camden* getCamden() const;            // Returns a pointer to the AI logic.
+        Camden* getRival() const;             // Returns the AI in the human's seat (headless games only).
+        bool getIsHeadless() const;           // Returns whether the game runs without console I/O.
         PlayerType getTurn() const;           // Returns the current player's turn.
+        PlayerType getFirstTurn() const;      // Returns the player who fired first.
 
         // **Setter Methods**
         void setHuman(Player* the_human);     // Sets the human player.
         void setCpu(Player* the_cpu);         // Sets the CPU player.
         void setCamden(Camden* new_camden);   // Sets the AI logic.
         void setTurn(PlayerType turn);        // Sets the current turn.
+        void setCamdenPrior(const PlacementPrior* prior); // Sets the hunting weights of Camden, now or once it is made.
+        void setCamdenBudget(const SearchBudget& budget); // Sets the work per ROLLOUT move of Camden, now or once it is made.
+        void setHeatmapCache(HeatmapCache* heatmap_cache); // Shares HARD weights between both AIs and other games, now or once they are made.
 
         // **Game State Checks**
         bool someoneHasWon() const;           // Checks if any player has won the game.
@@ -42,17 +64,20 @@ class Game {
 
         // **Game Flow Methods**
         void switchTurn();                    // Switches the turn between the human and CPU players.
-        void doCpuTurn(int(*rand_func)()) const;  // Executes the CPU's turn using AI logic.
+        void doCpuTurn(Random& rand_func) const;  // Executes the CPU's turn using AI logic.
         void doHumanTurn() const;             // Executes the human player's turn.
-        void doTurn(int(*rand_func)());       // Executes a turn for the current player.
+        void doRivalTurn(Random& rand_func) const; // Executes the human seat's turn with the rival AI (headless).
+        void doTurn(Random& rand_func);       // Executes a turn for the current player.
 
         // **Setup Methods**
-        void doSetUp(int(*rand_func)());      // Sets up the game by placing ships for both players.
-        void doCoinToss(int(*rand_func)());   // Simulates a coin toss to decide who goes first.
+        void doSetUp(Random& rand_func);      // Sets up the game by placing ships for both players.
+        void doCoinToss(Random& rand_func);   // Simulates a coin toss to decide who goes first.
         void doFinalSetup();                  // Finalizes setup by linking players and initializing AI.
 
         // **Main Game Loop**
-        void playGame(int(*rand_func)());     // Main game loop that alternates turns until a winner is determined.
+        void playGame(Random& rand_func);     // Main game loop that alternates turns until a winner is determined.
+        void playHeadlessGame(Random& rand_func); // Sets up and plays a whole headless game at machine speed.
+        void reset();                         // Clears the last game so the same objects can play the next one.
 };
 
 #endif
@@ -0,0 +1,125 @@
+#include "GameState.h"
+
+#include "Enums.h"          // Seats and ship types.
+#include "Bitboard.h"       // Masks.
+#include "Placements.h"     // Ship placements.
+#include "FleetGenerator.h" // Fleets.
+#include "Game.h"           // The object model.
+#include "Player.h"         // Fleets and shots of a seat.
+#include "Grid.h"           // Masks of a seat's grid.
+
+#include <type_traits>
+    using std::is_trivially_copyable;
+
+#include <stdexcept>
+    using std::logic_error;
+    using std::invalid_argument;
+
+static_assert(is_trivially_copyable<GameState>::value, "A GameState is cloned with a plain copy.");
+static_assert(sizeof(GameState) <= 128, "A GameState fits in two cache lines.");
+
+// **Encode a Ship**
+// Its lowest space is its top or left end whichever way it was laid.
+uint8_t GameState::shipByte(Bitboard ship_mask) {
+    if(ship_mask.none())
+        return NOT_PLACED;
+    int start = ship_mask.lowest();
+    return static_cast<uint8_t>(start) | (ship_mask.test(start + 10) ? VERTICAL : 0);
+}
+
+// **From Fleets**
+GameState GameState::fromFleets(const Fleet& human_fleet, const Fleet& cpu_fleet, PlayerType first_turn) {
+    GameState state {};
+    for(PlayerType owner : {CPU, MAN}) {
+        const Fleet& fleet = owner == MAN ? human_fleet : cpu_fleet;
+        state.fleets[owner] = fleet.occupancy;
+        for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+            state.ships[owner][ship_type] = shipByte(fleet.ships[ship_type].mask);
+            state.hitsLeft[owner][ship_type] = static_cast<uint8_t>(fleet.ships[ship_type].mask.count());
+        }
+    }
+    state.turn = static_cast<uint8_t>(first_turn);
+    return state;
+}
+
+// **From a Game**
+// Reads everything off the two grids' masks, so no stud or space is visited.
+GameState GameState::fromGame(const Game& game) {
+    GameState state {};
+    for(PlayerType owner : {CPU, MAN}) {
+        Player* player = owner == MAN ? game.getHuman() : game.getCpu();
+        Grid* grid = player->getGrid();
+        state.fleets[owner] = grid->getOccupancyMask();
+        state.shots[owner] = grid->getHitMask() | grid->getMissMask();
+        for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+            Bitboard ship_mask = grid->getShipMask(static_cast<ShipType>(ship_type));
+            state.ships[owner][ship_type] = shipByte(ship_mask);
+            state.hitsLeft[owner][ship_type] = static_cast<uint8_t>((ship_mask & ~state.shots[owner]).count());
+            if(ship_mask.any() && state.hitsLeft[owner][ship_type] == 0)
+                state.sunkFleets[owner] |= static_cast<uint8_t>(1 << ship_type);
+        }
+        state.numShots[owner] = static_cast<uint8_t>(player->getNumShots());
+    }
+    state.turn = static_cast<uint8_t>(game.getTurn());
+    return state;
+}
+
+// **Apply to a Game**
+// Resets the game, places both fleets, links the seats and fires every shot in
+// grid order, so the grids, ships and shot masks match the state. The AIs start
+// from a blank memory and the shot logs are in grid order, not firing order.
+void GameState::applyTo(Game& game) const {
+    game.reset();
+    for(PlayerType owner : {CPU, MAN}) {
+        Fleet fleet;
+        for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+            ShipType type = static_cast<ShipType>(ship_type);
+            uint8_t ship = this->ships[owner][ship_type];
+            if(ship == NOT_PLACED)
+                throw logic_error("Only states with both fleets placed can be applied to a game.");
+            fleet.ships[ship_type] = Placements::at(Ships::lengthOf(type), static_cast<SpaceName>((ship & ~VERTICAL) + 1), ship & VERTICAL ? 'S' : 'E');
+            fleet.occupancy |= fleet.ships[ship_type].mask;
+        }
+        (owner == MAN ? game.getHuman() : game.getCpu())->setFleet(fleet);
+    }
+    game.doFinalSetup();
+    for(PlayerType shooter : {CPU, MAN}) {
+        Player* player = shooter == MAN ? game.getHuman() : game.getCpu();
+        Bitboard rest = this->shots[foeOf(shooter)];
+        while(rest.any())
+            player->target(static_cast<SpaceName>(rest.popLowest() + 1), false);
+    }
+    game.setTurn(this->getTurn());
+}
+
+// **Fire**
+// Marks the space, takes a hit off the ship there if there is one, and passes the turn.
+TargetResult GameState::fire(SpaceName space) {
+    PlayerType shooter = this->getTurn();
+    PlayerType owner = foeOf(shooter);
+    int index = static_cast<int>(space) - 1;
+    if(this->shots[owner].test(index))
+        throw invalid_argument("Space already fired at.");
+    this->shots[owner].set(index);
+    ++this->numShots[shooter];
+    this->turn = static_cast<uint8_t>(owner);
+    if(!this->fleets[owner].test(index))
+        return MISS;
+    for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+        if(this->getShipMask(owner, static_cast<ShipType>(ship_type)).test(index)) {
+            if(--this->hitsLeft[owner][ship_type] == 0)
+                this->sunkFleets[owner] |= static_cast<uint8_t>(1 << ship_type);
+            break;
+        }
+    }
+    return HIT;
+}
+
+// **Winner**
+PlayerType GameState::winner() const {
+    if(this->sunkFleets[MAN] == ALL_SUNK)
+        return CPU;
+    if(this->sunkFleets[CPU] == ALL_SUNK)
+        return MAN;
+    throw logic_error("Nobody has won yet.");
+}
@@ -0,0 +1,67 @@
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include "Enums.h"          // Seats, ship types and shot results.
+#include "Bitboard.h"       // Fleets and shots as sets of spaces.
+#include "Placements.h"     // Ship spaces from a start and an orientation.
+#include "FleetGenerator.h" // Fleets to start a state from.
+
+#include <array>
+    using std::array;
+
+#include <cstdint>
+    using std::uint8_t;
+
+class Game;
+
+// **GameState Struct**
+// A whole game between two fleets as one small value: where every ship lies, which
+// spaces each side has fired at, how many hits each ship can still take and whose
+// turn it is. It holds no pointers and is trivially copyable, so cloning it is a
+// plain copy of under two cache lines, which is what rollout and search AIs need.
+// Arrays are indexed by PlayerType; a grid is named by the seat that owns it, so
+// shots[MAN] are the spaces Camden (the CPU) fired at on the human seat's grid.
+// The AIs' own memory and the order of the shots are not part of the state.
+struct GameState {
+    array<Bitboard, 2> fleets;            // Spaces holding a ship, by grid owner.
+    array<Bitboard, 2> shots;             // Spaces fired at, by grid owner.
+    array<array<uint8_t, 5>, 2> ships;    // Bit index of each ship's top or left end, plus VERTICAL, by owner and ShipType; NOT_PLACED if absent.
+    array<array<uint8_t, 5>, 2> hitsLeft; // Hits each ship can still take, by owner and ShipType.
+    array<uint8_t, 2> sunkFleets;         // Bit t set once the owner's ship of ShipType t is sunk.
+    array<uint8_t, 2> numShots;           // Shots fired, by shooter.
+    uint8_t turn;                         // PlayerType of the seat to fire next.
+
+    static constexpr uint8_t VERTICAL = 0x80;    // Ship byte bit for a ship running down a column.
+    static constexpr uint8_t NOT_PLACED = 0xFF;  // Ship byte of a ship not on the grid.
+    static constexpr uint8_t ALL_SUNK = 0x1F;    // sunkFleets value once all five ships are down.
+
+    // **Conversions**
+    static GameState fromFleets(const Fleet& human_fleet, const Fleet& cpu_fleet, PlayerType first_turn); // A game before the first shot.
+    static GameState fromGame(const Game& game); // Snapshot of a game's players and turn.
+    void applyTo(Game& game) const;              // Resets a game and rebuilds this state on its objects.
+
+    // **Fleets**
+    static uint8_t shipByte(Bitboard ship_mask); // Encodes the spaces of one ship.
+    Bitboard getShipMask(PlayerType owner, ShipType ship_type) const { // Spaces of one ship, empty if it is not placed.
+        uint8_t ship = this->ships[owner][ship_type];
+        if (ship == NOT_PLACED)
+            return Bitboard();
+        SpaceName start = static_cast<SpaceName>((ship & ~VERTICAL) + 1);
+        return Placements::at(Ships::lengthOf(ship_type), start, ship & VERTICAL ? 'S' : 'E').mask;
+    }
+    bool shipIsSunk(PlayerType owner, ShipType ship_type) const { return this->sunkFleets[owner] >> ship_type & 1; }
+
+    // **Shots**
+    Bitboard getHits(PlayerType owner) const { return this->shots[owner] & this->fleets[owner]; }    // Hits on the owner's grid.
+    Bitboard getMisses(PlayerType owner) const { return this->shots[owner] & ~this->fleets[owner]; } // Misses on the owner's grid.
+    bool canFire(SpaceName space) const { return !this->shots[foeOf(this->getTurn())].has(space); }   // True if the seat to move has not fired there yet.
+    TargetResult fire(SpaceName space); // Fires for the seat to move and passes the turn; throws if the space was fired at.
+
+    // **Turn and Outcome**
+    PlayerType getTurn() const { return static_cast<PlayerType>(this->turn); }
+    bool isOver() const { return this->sunkFleets[CPU] == ALL_SUNK || this->sunkFleets[MAN] == ALL_SUNK; }
+    PlayerType winner() const; // The seat that sank the other's fleet; throws if nobody has yet.
+    static constexpr PlayerType foeOf(PlayerType player_type) { return player_type == CPU ? MAN : CPU; }
+};
+
+#endif
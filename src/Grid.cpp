@@ -31,7 +31,7 @@ void Grid::populate_grid() {
 // Method: Populates the grid with new GridSpace objects associated with a player.
 void Grid::populate_grid(PlayerType of_player) {
     for(size_t i = 0; i < 100; ++i)
-        this->grid[i] = new GridSpace(Spaces::spaceNames[i], of_player);
+        this->grid[i] = Arena::make<GridSpace>(this->arena, Spaces::spaceNames[i], of_player);
 }
 
 // Constructor: Initializes the grid with empty spaces.
@@ -40,20 +40,20 @@ Grid::Grid() {
 }
 
 // Constructor: Initializes the grid and associates it with a player.
-Grid::Grid(PlayerType of_player) : ofPlayer{of_player} {
+Grid::Grid(PlayerType of_player, Arena* the_arena) : ofPlayer{of_player}, arena{the_arena} {
     this->populate_grid(of_player); // Populate grid with GridSpace objects for the player.
 }
 
 // Destructor: Cleans up dynamically allocated GridSpace objects.
 Grid::~Grid() {
     for(size_t i = 0; i < 100; i++) {
-        delete this->grid[i]; // Delete each GridSpace object to free memory.
+        Arena::destroy(this->arena, this->grid[i]); // Delete each GridSpace object to free memory.
         this->grid[i] = nullptr; // Set pointer to nullptr to avoid dangling pointers.
     }
 }
 
 // Getter: Returns the grid as an array of GridSpace pointers.
-array<GridSpace*, 100> Grid::getGrid() const {
+const array<GridSpace*, 100>& Grid::getGrid() const {
     return this->grid;
 }
 
@@ -62,9 +62,39 @@ PlayerType Grid::getOfPlayer() const {
     return this->ofPlayer;
 }
 
+// Getter: Returns the allocator of the grid's objects.
+Arena* Grid::getArena() const {
+    return this->arena;
+}
+
 // Getter: Returns a vector of "no-go" spaces.
 vector<SpaceName> Grid::getNoGoSpaces() const {
-    return this->noGoSpaces;
+    return this->noGoMask.toSpaceNames();
+}
+
+// Getter: Returns the "no-go" spaces as a mask.
+Bitboard Grid::getNoGoMask() const {
+    return this->noGoMask;
+}
+
+// Getter: Returns the spaces holding a stud.
+Bitboard Grid::getOccupancyMask() const {
+    return this->occupancyMask;
+}
+
+// Getter: Returns the targeted spaces that held a stud.
+Bitboard Grid::getHitMask() const {
+    return this->hitMask;
+}
+
+// Getter: Returns the targeted spaces that were empty.
+Bitboard Grid::getMissMask() const {
+    return this->missMask;
+}
+
+// Getter: Returns the spaces of one ship.
+Bitboard Grid::getShipMask(ShipType ship_type) const {
+    return this->shipMasks[ship_type];
 }
 
 // Setter: Sets the grid with a given array of GridSpace pointers.
@@ -77,10 +107,9 @@ void Grid::setOfPlayer(PlayerType of_player) {
     this->ofPlayer = of_player;
 }
 
-// Method: Adds a space to the "no-go" list if it is not already present.
+// Method: Adds a space to the "no-go" list; adding it twice changes nothing.
 void Grid::addNoGoSpace(SpaceName space) {
-    if(!this->isNoGoSpace(space))
-        this->noGoSpaces.push_back(space);
+    this->noGoMask |= Bitboard::of(space);
 }
 
 // Method: Adds multiple spaces to the "no-go" list using a vector of space strings.
@@ -89,6 +118,17 @@ void Grid::addNoGoSpaces(vector<string> space_strings) {
         this->addNoGoSpace(Spaces::nameFromString(space_string));
 }
 
+// Method: Adds multiple spaces to the "no-go" list using a vector of SpaceNames.
+void Grid::addNoGoSpaces(const vector<SpaceName>& space_names) {
+    for(SpaceName space_name : space_names)
+        this->addNoGoSpace(space_name);
+}
+
+// Method: Adds a mask of spaces to the "no-go" list in one union.
+void Grid::addNoGoSpaces(Bitboard spaces) {
+    this->noGoMask |= spaces;
+}
+
 // Getter: Returns a pointer to a GridSpace given its SpaceName.
 GridSpace* Grid::getSpace(SpaceName space_name) const {
     return this->grid[static_cast<size_t>(space_name) - 1]; // Adjust for 0-indexing.
@@ -113,10 +153,7 @@ GridSpace* Grid::getSpace(int column_number, int row_number) const {
 
 // Method: Checks if a space is in the "no-go" list using its SpaceName.
 bool Grid::isNoGoSpace(SpaceName space_name) const {
-    for(SpaceName space : this->noGoSpaces)
-        if(space_name == space)
-            return true;
-    return false;
+    return this->noGoMask.has(space_name);
 }
 
 // Method: Checks if a space is in the "no-go" list using its string representation.
@@ -132,6 +169,24 @@ bool Grid::hasNoGoSpace(vector<string> space_strings) const {
     return false;
 }
 
+// Method: Checks if any of the given SpaceNames are in the "no-go" list.
+bool Grid::hasNoGoSpace(const vector<SpaceName>& space_names) const {
+    for(SpaceName space_name : space_names)
+        if(this->isNoGoSpace(space_name))
+            return true;
+    return false;
+}
+
+// Method: Checks if any space of a mask is in the "no-go" list.
+bool Grid::hasNoGoSpace(Bitboard spaces) const {
+    return spaces.intersects(this->noGoMask);
+}
+
+// Method: Checks a placement against the "no-go" spaces with one AND.
+bool Grid::canPlace(const Placement& placement) const {
+    return placement.fits() && !this->hasNoGoSpace(placement.mask);
+}
+
 // Method: Gets the space string north of the given space string.
 string Grid::N(string start) {
     char letter = start.at(0);
@@ -223,54 +278,153 @@ vector<string> Grid::getVector(string start, char direction, int length, bool in
     return the_vector;
 }
 
+// Method: Gets the space north of the given space.
+SpaceName Grid::N(SpaceName start) {
+    SpaceName space = stepDirection(start, 'N');
+    if(space == NO_SPACE)
+        throw out_of_range("Cannot go North from first row."); // Throw exception if at the top row.
+    return space;
+}
+
+// Method: Gets the space south of the given space.
+SpaceName Grid::S(SpaceName start) {
+    SpaceName space = stepDirection(start, 'S');
+    if(space == NO_SPACE)
+        throw out_of_range("Cannot go South from last row."); // Throw exception if at the bottom row.
+    return space;
+}
+
+// Method: Gets the space east of the given space.
+SpaceName Grid::E(SpaceName start) {
+    SpaceName space = stepDirection(start, 'E');
+    if(space == NO_SPACE)
+        throw out_of_range("Cannot go East from last column."); // Throw exception if at the rightmost column.
+    return space;
+}
+
+// Method: Gets the space west of the given space.
+SpaceName Grid::W(SpaceName start) {
+    SpaceName space = stepDirection(start, 'W');
+    if(space == NO_SPACE)
+        throw out_of_range("Cannot go West from first column."); // Throw exception if at the leftmost column.
+    return space;
+}
+
+// Method: Returns the space after moving in the specified direction from a starting space.
+SpaceName Grid::goDirection(SpaceName start, char direction) {
+    switch(direction) {
+        case 'N': return N(start);
+        case 'S': return S(start);
+        case 'E': return E(start);
+        case 'W': return W(start);
+        default: throw invalid_argument("Bad direction."); // Throw exception for invalid direction.
+    }
+}
+
+// Method: Generates a vector of spaces in a specified direction and length.
+vector<SpaceName> Grid::getVector(SpaceName start, char direction, int length, bool include_start) {
+    vector<SpaceName> the_vector;
+    the_vector.reserve(static_cast<size_t>(length) + 1);
+    if (include_start)
+        the_vector.push_back(start); // Include starting space if requested.
+    SpaceName cur = start;
+    for(int i = 0; i < length; i++) {
+        cur = goDirection(cur, direction); // Move to the next space in the specified direction.
+        the_vector.push_back(cur);
+    }
+    return the_vector;
+}
+
+// Method: Returns the spaces directly north, south, east and west of a given space.
+vector<SpaceName> Grid::neighborSpaces(SpaceName space_name) {
+    return neighborMask(space_name).toSpaceNames(); // In grid order; edges simply have fewer neighbors.
+}
+
+// Method: Returns the spaces next to a group of spaces (e.g. a ship), without the group itself or repeats.
+vector<SpaceName> Grid::neighborSpaces(const vector<SpaceName>& space_names) {
+    Bitboard group;
+    for(SpaceName space_name : space_names)
+        group |= Bitboard::of(space_name);
+    return group.neighbors().toSpaceNames(); // In grid order.
+}
+
 // Method: Returns a vector of neighboring space strings for a given space string.
 vector<string> Grid::neighborSpaces(string space_string) {
     vector<string> neighbors;
-    char directions[] = {'N', 'S', 'E', 'W'}; // Possible directions.
-    for(char direction : directions) {
-        try {
-            neighbors.push_back(goDirection(space_string, direction)); // Try to get the neighboring space.
-        } catch(out_of_range e) {
-            continue; // Skip if out of bounds.
-        }
-    }
+    for(SpaceName neighbor : neighborSpaces(Spaces::nameFromString(space_string)))
+        neighbors.push_back(Spaces::stringFromName(neighbor)); // Convert back only for string callers.
     return neighbors;
 }
 
 // Method: Returns a vector of neighboring space strings for multiple space strings.
 vector<string> Grid::neighborSpaces(vector<string> space_strings) {
+    vector<SpaceName> space_names;
+    space_names.reserve(space_strings.size());
+    for(const string& space_string : space_strings)
+        space_names.push_back(Spaces::nameFromString(space_string));
     vector<string> neighbors;
-    if(space_strings.size() == 1)
-        return neighborSpaces(space_strings[0]); // Return single space neighbors if only one space is provided.
-    for(size_t i = 0; i < space_strings.size(); i++) {
-        vector<string> neighbor_spaces = neighborSpaces(space_strings[i]);
-        if(i == 0 || i == (space_strings.size())) {
-            if(i == 0)
-                for(string neighbor_space : neighbor_spaces)
-                    if(neighbor_space != space_strings[1])
-                        neighbors.push_back(neighbor_space); // Exclude immediate neighbor.
-            else
-                for(string neighbor_space : neighbor_spaces)
-                    if(neighbor_space != space_strings[i - 1])
-                        neighbors.push_back(neighbor_space); // Exclude previous space.
-        } else
-            for(string neighbor_space : neighbor_spaces)
-                if(neighbor_space != space_strings[i - 1] && neighbor_space != space_strings[i + 1])
-                    neighbors.push_back(neighbor_space); // Exclude both adjacent spaces.
-    }
+    for(SpaceName neighbor : neighborSpaces(space_names))
+        neighbors.push_back(Spaces::stringFromName(neighbor)); // Convert back only for string callers.
     return neighbors;
 }
 
 // Method: Places a stud on a specific space in the grid.
-void Grid::setOnSpace(string space, Stud* stud) const {
-    GridSpace* gspace = this->getSpace(space); // Get the space on the grid.
+void Grid::setOnSpace(string space, Stud* stud) {
+    this->setOnSpace(Spaces::nameFromString(space), stud);
+}
+
+// Method: Places a stud on a specific space in the grid, given its SpaceName.
+void Grid::setOnSpace(SpaceName space_name, Stud* stud) {
+    GridSpace* gspace = this->getSpace(space_name); // Get the space on the grid.
     gspace->addStud(stud); // Add the stud to the space.
-    stud->setOnSpace(gspace->getSpaceName()); // Associate the space with the stud.
+    stud->setOnSpace(space_name); // Associate the space with the stud.
+    Bitboard space_bit = Bitboard::of(space_name);
+    this->occupancyMask |= space_bit; // Record the stud in the masks.
+    this->shipMasks[stud->getForShip()] |= space_bit;
+}
+
+// Method: Checks if a space was already targeted, from the hit and miss masks.
+bool Grid::spaceWasTargeted(SpaceName space_name) const {
+    return (this->hitMask | this->missMask).has(space_name);
+}
+
+// Method: Returns the type of the ship with a stud on the given space.
+ShipType Grid::shipTypeAt(SpaceName space_name) const {
+    for(size_t i = 0; i < this->shipMasks.size(); i++)
+        if(this->shipMasks[i].has(space_name))
+            return static_cast<ShipType>(i);
+    throw invalid_argument("No ship on space."); // Throw exception if the space is empty.
+}
+
+// Method: Checks if a placed ship has been hit on all of its spaces.
+bool Grid::shipIsSunk(ShipType ship_type) const {
+    Bitboard ship_mask = this->shipMasks[ship_type];
+    return ship_mask.any() && (ship_mask & ~this->hitMask).none();
+}
+
+// Method: Checks if every stud on the grid has been hit.
+bool Grid::allShipsSunk() const {
+    return this->occupancyMask.any() && (this->occupancyMask & ~this->hitMask).none();
 }
 
 // Method: Targets a specific space on the grid and returns the result.
-TargetResult Grid::target(string space_string) const {
-    return this->getSpace(space_string)->target(); // Call the target method on the GridSpace.
+TargetResult Grid::target(string space_string) {
+    return this->target(Spaces::nameFromString(space_string));
+}
+
+// Method: Targets a space given its SpaceName and returns the result.
+// The outcome comes from the occupancy mask; the GridSpace is still targeted to keep labels and studs in sync.
+TargetResult Grid::target(SpaceName space_name) {
+    if(this->spaceWasTargeted(space_name))
+        throw invalid_argument("Space already targeted."); // Prevents retargeting the same space.
+    Bitboard space_bit = Bitboard::of(space_name);
+    TargetResult result = this->occupancyMask.intersects(space_bit) ? HIT : MISS;
+    if(result == HIT)
+        this->hitMask |= space_bit;
+    else
+        this->missMask |= space_bit;
+    this->getSpace(space_name)->target(); // Update the GridSpace labels and notify the stud.
+    return result;
 }
 
 // Method: Displays the grid, optionally showing hidden details for Camden (CPU).
@@ -290,3 +444,16 @@ void Grid::showGrid(bool show_camden) const {
         cout << "\n"; // Move to the next line after each row.
     }
 }
+
+// Method: Takes every stud off the grid and clears every shot and mask, as on a new grid.
+// The GridSpace objects are kept, so a grid can host game after game without allocating.
+void Grid::reset() {
+    for(GridSpace* gspace : this->grid)
+        if(gspace != nullptr)
+            gspace->reset();
+    this->noGoMask = Bitboard();
+    this->occupancyMask = Bitboard();
+    this->hitMask = Bitboard();
+    this->missMask = Bitboard();
+    this->shipMasks.fill(Bitboard());
+}
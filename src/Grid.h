@@ -12,13 +12,21 @@
 
 #include "Enums.h" // Include for enumerated types used in the class.
 #include "GridSpace.h" // Include for the GridSpace class representing individual grid spaces.
+#include "Bitboard.h" // Include for the Bitboard masks mirroring the grid state.
+#include "Placements.h" // Include for the table of legal ship placements.
+#include "Arena.h" // Include for the per-game allocator.
 
 // Declaration of the Grid class.
 class Grid {
     private:
         array<GridSpace*, 100> grid; // Array to hold pointers to GridSpace objects, representing the game grid.
         PlayerType ofPlayer; // Player type associated with this grid (e.g., CPU or human).
-        vector<SpaceName> noGoSpaces; // Vector of spaces marked as "no-go" for placement.
+        Arena* arena {nullptr}; // Allocator of the grid's spaces and ships, or nullptr for the heap.
+        Bitboard noGoMask; // Spaces marked as "no-go" for placement (ships and their neighbors).
+        Bitboard occupancyMask; // Spaces holding a stud of any ship.
+        Bitboard hitMask; // Targeted spaces that held a stud.
+        Bitboard missMask; // Targeted spaces that were empty.
+        array<Bitboard, 5> shipMasks; // Spaces of each ship, indexed by ShipType.
 
         // Private methods to initialize the grid.
         void populate_grid(); // Populates the grid with nullptr to initialize spaces.
@@ -27,13 +35,19 @@ class Grid {
     public:
         // Constructors and Destructor.
         Grid(); // Default constructor that initializes the grid with empty spaces.
-        explicit Grid(PlayerType of_player); // Constructor that initializes the grid for a specific player.
+        explicit Grid(PlayerType of_player, Arena* the_arena = nullptr); // Constructor that initializes the grid for a specific player.
         ~Grid(); // Destructor to clean up dynamically allocated GridSpace objects.
 
         // Getter methods.
-        array<GridSpace*, 100> getGrid() const; // Returns the grid as an array of GridSpace pointers.
+        const array<GridSpace*, 100>& getGrid() const; // Returns the grid's array of GridSpace pointers without copying it.
         PlayerType getOfPlayer() const; // Returns the player type associated with the grid.
-        vector<SpaceName> getNoGoSpaces() const; // Returns the vector of "no-go" spaces.
+        Arena* getArena() const; // Returns the allocator of the grid's objects (nullptr for the heap).
+        vector<SpaceName> getNoGoSpaces() const; // Returns the "no-go" spaces in grid order.
+        Bitboard getNoGoMask() const; // Returns the "no-go" spaces as a mask.
+        Bitboard getOccupancyMask() const; // Returns the spaces holding a stud.
+        Bitboard getHitMask() const; // Returns the targeted spaces that held a stud.
+        Bitboard getMissMask() const; // Returns the targeted spaces that were empty.
+        Bitboard getShipMask(ShipType ship_type) const; // Returns the spaces of one ship.
 
         // Setter methods.
         void setGrid(array<GridSpace*, 100> the_grid); // Sets the grid with a given array of GridSpace pointers.
@@ -42,6 +56,8 @@ class Grid {
         // Methods to manage "no-go" spaces.
         void addNoGoSpace(SpaceName space); // Adds a single space to the "no-go" list.
         void addNoGoSpaces(vector<string> space_strings); // Adds multiple spaces to the "no-go" list.
+        void addNoGoSpaces(const vector<SpaceName>& space_names); // Adds multiple spaces to the "no-go" list.
+        void addNoGoSpaces(Bitboard spaces); // Adds a whole mask of spaces (e.g. a ship and its halo) at once.
 
         // Methods to retrieve GridSpace objects.
         GridSpace* getSpace(SpaceName space_name) const; // Returns a pointer to a GridSpace given its SpaceName.
@@ -53,6 +69,9 @@ class Grid {
         bool isNoGoSpace(string space_string) const; // Checks if a space is in the "no-go" list using its string representation.
         bool isNoGoSpace(SpaceName space_name) const; // Checks if a space is in the "no-go" list using its SpaceName.
         bool hasNoGoSpace(vector<string> space_strings) const; // Checks if any given spaces are in the "no-go" list.
+        bool hasNoGoSpace(const vector<SpaceName>& space_names) const; // Checks if any given spaces are in the "no-go" list.
+        bool hasNoGoSpace(Bitboard spaces) const; // Checks a whole mask of spaces against the "no-go" list with one AND.
+        bool canPlace(const Placement& placement) const; // Checks that a placement neither overlaps nor touches a ship.
 
         // Static methods for navigating the grid.
         static string N(string start); // Gets the space string north of the given space.
@@ -62,15 +81,50 @@ class Grid {
         static string goDirection(string start, char direction); // Returns a new space string after moving in the specified direction.
         static vector<string> getVector(string start, char direction, int length, bool include_start = true); // Generates a vector of space strings in a direction.
 
+        // Static methods for navigating the grid by SpaceName, without building strings.
+        static SpaceName N(SpaceName start); // Gets the space north of the given space.
+        static SpaceName S(SpaceName start); // Gets the space south of the given space.
+        static SpaceName E(SpaceName start); // Gets the space east of the given space.
+        static SpaceName W(SpaceName start); // Gets the space west of the given space.
+        static SpaceName goDirection(SpaceName start, char direction); // Returns the space after moving in the specified direction.
+        static vector<SpaceName> getVector(SpaceName start, char direction, int length, bool include_start = true); // Generates a vector of spaces in a direction.
+
+        // Static methods for navigating the grid without exceptions, for loops that routinely reach the edge.
+        static constexpr SpaceName stepDirection(SpaceName start, char direction) { // The next space, or NO_SPACE past the edge or for a bad direction.
+            int column_index = Spaces::columnIndex(start);
+            int row_index = Spaces::rowIndex(start);
+            switch(direction) {
+                case 'N': return row_index == 0 ? NO_SPACE : static_cast<SpaceName>(start - 10);
+                case 'S': return row_index == 9 ? NO_SPACE : static_cast<SpaceName>(start + 10);
+                case 'E': return column_index == 9 ? NO_SPACE : static_cast<SpaceName>(start + 1);
+                case 'W': return column_index == 0 ? NO_SPACE : static_cast<SpaceName>(start - 1);
+                default: return NO_SPACE;
+            }
+        }
+        static constexpr Bitboard neighborMask(SpaceName space_name) { return Bitboard::of(space_name).neighbors(); } // The 2 to 4 spaces next to a space.
+
         // Static methods for finding neighboring spaces.
         static vector<string> neighborSpaces(string space_string); // Returns a vector of neighboring spaces for a given space.
         static vector<string> neighborSpaces(vector<string> space_strings); // Returns a vector of neighboring spaces for multiple spaces.
+        static vector<SpaceName> neighborSpaces(SpaceName space_name); // Returns the spaces next to a given space.
+        static vector<SpaceName> neighborSpaces(const vector<SpaceName>& space_names); // Returns the spaces next to a group of spaces, excluding the group.
+
+        // Methods to place a stud on a specific space in the grid.
+        void setOnSpace(string space, Stud* stud);
+        void setOnSpace(SpaceName space_name, Stud* stud);
+
+        // Methods to query the grid state through its masks.
+        bool spaceWasTargeted(SpaceName space_name) const; // Checks if a space was already hit or missed.
+        ShipType shipTypeAt(SpaceName space_name) const; // Returns the type of the ship on a space.
+        bool shipIsSunk(ShipType ship_type) const; // Checks if every space of a placed ship was hit.
+        bool allShipsSunk() const; // Checks if every placed stud was hit.
 
-        // Method to place a stud on a specific space in the grid.
-        void setOnSpace(string space, Stud* stud) const;
+        // Methods to target a specific space and return the result.
+        TargetResult target(string space_string);
+        TargetResult target(SpaceName space_name);
 
-        // Method to target a specific space and return the result.
-        TargetResult target(string space_string) const;
+        // Method to empty every space and mask for the next game, keeping the GridSpace objects.
+        void reset();
 
         // Method to display the grid, with an option to show hidden details for Camden (CPU).
         void showGrid(bool show_camden = false) const;
@@ -125,3 +125,11 @@ TargetResult GridSpace::target() {
         return TargetResult::MISS;
     }
 }
+
+// Removes the stud and the shot, leaving the space as it was when built.
+void GridSpace::reset() {
+    this->status = SpaceStatus::UNTARGETED;
+    this->stud = nullptr; // The stud belongs to its ship and is not freed here.
+    this->label = '+';
+    this->primeLabel = '+';
+}
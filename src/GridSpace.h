@@ -68,6 +68,9 @@ class GridSpace {
 
         // Method to target the space and return the result (HIT or MISS).
         TargetResult target();
+
+        // Method to empty the space and clear its target status for the next game.
+        void reset();
 };
 
 #endif // End of include guard.
@@ -0,0 +1,144 @@
+#include "Heatmap.h"
+
+#include "Enums.h"     // SpaceName, ShipType and ship lengths.
+#include "Bitboard.h"  // Placement masks.
+#include "Placements.h"  // The placement table.
+#include "Random.h"    // Tie breaks.
+#include "View.h"      // Afloat ship types.
+#include "PlacementPrior.h" // Hunting weights.
+
+#include <array>
+    using std::array;
+#include <vector>
+    using std::vector;
+
+// **Constructor**
+// Starts from every placement and counts how many cover each space.
+Heatmap::Heatmap() {
+    this->reset();
+}
+
+// **Reset**
+// Refills the placement lists from the table; assign keeps their capacity, so no allocation after the first game.
+void Heatmap::reset() {
+    this->seenHits = Bitboard();
+    this->seenBlocked = Bitboard();
+    for (int length_index = 0; length_index < NUM_LENGTHS; ++length_index) {
+        int length = length_index + MIN_LENGTH;
+        this->alive[length_index].assign(Placements::begin(length), Placements::end(length));
+        this->counts[length_index].fill(0);
+        for (const Placement& placement : this->alive[length_index]) {
+            Bitboard rest = placement.mask;
+            while (rest.any())
+                ++this->counts[length_index][rest.popLowest()];
+        }
+    }
+}
+
+// **Set the Prior**
+void Heatmap::setPrior(const PlacementPrior* the_prior) {
+    this->prior = the_prior;
+}
+
+// **Get the Prior**
+const PlacementPrior* Heatmap::getPrior() const {
+    return this->prior;
+}
+
+// **Drop Ruled-Out Placements**
+// Swap-removes every placement that now overlaps a blocked space or touches a hit,
+// taking its spaces out of the counts.
+void Heatmap::drop_placements(int length_index) {
+    vector<Placement>& placements = this->alive[length_index];
+    size_t i = 0;
+    while (i < placements.size()) {
+        const Placement& placement = placements[i];
+        if (placement.mask.intersects(this->seenBlocked) || placement.halo.intersects(this->seenHits)) {
+            Bitboard rest = placement.mask;
+            while (rest.any())
+                --this->counts[length_index][rest.popLowest()];
+            placements[i] = placements.back();
+            placements.pop_back();
+        } else {
+            ++i;
+        }
+    }
+}
+
+// **Observe**
+// Does nothing unless something new was seen since the last call.
+void Heatmap::observe(Bitboard hits, Bitboard blocked) {
+    if (hits == this->seenHits && blocked == this->seenBlocked)
+        return;
+    this->seenHits = hits;
+    this->seenBlocked = blocked;
+    for (int length_index = 0; length_index < NUM_LENGTHS; ++length_index)
+        this->drop_placements(length_index);
+}
+
+// **Count**
+int Heatmap::count(int length, SpaceName space) const {
+    return this->counts[length - MIN_LENGTH][static_cast<int>(space) - 1];
+}
+
+// **Legal Placements**
+View<Placement> Heatmap::viewPlacements(int length) const {
+    return View<Placement>(this->alive[length - MIN_LENGTH]);
+}
+
+// **Weigh the Spaces**
+// Hunting: sums the kept counts of each afloat ship, scaled by the prior if set.
+// Targeting: walks the legal placements through unresolved hits, weighting each by
+// the square of the hits it explains, since one ship covering several hits is far
+// likelier than several ships lined up against each other.
+void Heatmap::weigh(View<ShipType> afloat, Bitboard unresolved, Bitboard targeted, array<long, 100>& weights) const {
+    weights.fill(0);
+    if (unresolved.none()) {
+        for (ShipType ship_type : afloat) {
+            const array<int, 100>& length_counts = this->counts[Ships::lengthOf(ship_type) - MIN_LENGTH];
+            for (int i = 0; i < 100; ++i)
+                weights[i] += length_counts[i];
+        }
+        if (this->prior != nullptr)
+            for (int i = 0; i < 100; ++i)
+                weights[i] *= this->prior->weightAt(i);
+    } else {
+        for (ShipType ship_type : afloat) {
+            for (const Placement& placement : this->alive[Ships::lengthOf(ship_type) - MIN_LENGTH]) {
+                long covered = (placement.mask & unresolved).count();
+                if (covered == 0)
+                    continue;
+                Bitboard rest = placement.mask & ~targeted;
+                while (rest.any())
+                    weights[rest.popLowest()] += covered * covered;
+            }
+        }
+    }
+}
+
+// **Best Space**
+// The untargeted space of highest weight.
+SpaceName Heatmap::bestSpace(View<ShipType> afloat, Bitboard unresolved, Bitboard targeted, Random& rand_func) const {
+    array<long, 100> weights;
+    this->weigh(afloat, unresolved, targeted, weights);
+    return pickBest(weights, targeted, rand_func);
+}
+
+// **Pick the Best Space**
+SpaceName Heatmap::pickBest(const array<long, 100>& weights, Bitboard targeted, Random& rand_func) {
+    long best_weight = 0;
+    int best_index = -1;
+    int ties = 0;
+    Bitboard open = ~targeted;
+    while (open.any()) {
+        int i = open.popLowest();
+        if (weights[i] > best_weight) {
+            best_weight = weights[i];
+            best_index = i;
+            ties = 1;
+        } else if (weights[i] == best_weight && best_weight > 0 && rand_func.below(++ties) == 0) {
+            best_index = i; // Reservoir sampling keeps every tied space equally likely.
+        }
+    }
+    return best_index < 0 ? NO_SPACE : static_cast<SpaceName>(best_index + 1);
+}
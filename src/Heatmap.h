@@ -0,0 +1,59 @@
+#ifndef HEATMAP_H
+#define HEATMAP_H
+
+#include "Enums.h"     // SpaceName and ShipType.
+#include "Bitboard.h"  // Observations are sets of spaces.
+#include "Placements.h"  // Every placement of every ship length.
+#include "Random.h"    // Breaks ties between equally likely spaces.
+#include "View.h"      // The afloat ship types are read without a copy.
+#include "PlacementPrior.h" // Optional weights learned from recorded fleets.
+
+#include <array>
+    using std::array;
+#include <vector>
+    using std::vector;
+
+// **Heatmap Class**
+// Counts, for every space of the foe's grid, how many legal placements of the
+// ships still afloat cover it. A placement stays legal while it avoids every
+// miss and every sunk ship with its halo, and has no hit right next to it (ships
+// never touch, so that hit must belong to the placement itself). Observations only
+// ever grow, so placements are dropped as they are ruled out and the counts are
+// updated in place rather than rebuilt every turn.
+class Heatmap {
+    private:
+        static constexpr int MIN_LENGTH = Placements::MIN_LENGTH;   // Shortest ship (Cruiser).
+        static constexpr int NUM_LENGTHS = Placements::NUM_LENGTHS; // Ship lengths tracked.
+
+        array<vector<Placement>, NUM_LENGTHS> alive;      // Placements still legal, by length.
+        array<array<int, 100>, NUM_LENGTHS> counts {};    // Legal placements covering each space, by length.
+        Bitboard seenHits;                                // Hits already applied.
+        Bitboard seenBlocked;                             // Blocked spaces already applied.
+        const PlacementPrior* prior {nullptr};            // Scales hunting weights by space, or nullptr for none.
+
+        void drop_placements(int length_index);           // Removes placements ruled out by the seen masks.
+
+    public:
+        // **Constructor**
+        Heatmap(); // Every placement of every length starts out legal.
+
+        // **Updating**
+        void observe(Bitboard hits, Bitboard blocked); // Applies all hits and all spaces that can hold no afloat ship.
+        void reset(); // Makes every placement legal again, reusing the lists' storage; the prior stays.
+        void setPrior(const PlacementPrior* the_prior); // Weights hunting by where fleets were seen; nullptr for none.
+        const PlacementPrior* getPrior() const;         // The hunting weights, or nullptr for none.
+
+        // **Queries**
+        int count(int length, SpaceName space) const;              // Legal placements of a length covering a space.
+        View<Placement> viewPlacements(int length) const;          // Placements of a length still legal, in no particular order.
+        // Weight of every space by bit index, as bestSpace ranks them; targeted spaces may carry weight too.
+        void weigh(View<ShipType> afloat, Bitboard unresolved, Bitboard targeted, array<long, 100>& weights) const;
+        // The untargeted space with the highest weight, ties broken at random; NO_SPACE if none can hold a ship.
+        // While hits are unresolved, only placements through them are counted, favouring those covering more.
+        // While hunting, counts are scaled by the prior if there is one.
+        SpaceName bestSpace(View<ShipType> afloat, Bitboard unresolved, Bitboard targeted, Random& rand_func) const;
+        // The untargeted space of highest weight among weights from weigh, drawing ties as bestSpace does.
+        static SpaceName pickBest(const array<long, 100>& weights, Bitboard targeted, Random& rand_func);
+};
+
+#endif
@@ -0,0 +1,131 @@
+#include "HeatmapCache.h"
+
+#include "Bitboard.h" // Masks.
+#include "Random.h"   // Hash mixing.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <mutex>
+    using std::mutex;
+    using std::lock_guard;
+
+#include <algorithm>
+    using std::min;
+
+#include <limits>
+    using std::numeric_limits;
+
+#include <cstdint>
+    using std::uintptr_t;
+
+// **Hash**
+// Each word is folded in through the same mixer that derives per-game seeds.
+uint64_t HeatmapKey::hash() const {
+    uint64_t h = Random::mix(this->hits.lo, this->hits.hi);
+    h = Random::mix(h ^ this->misses.lo, this->misses.hi);
+    h = Random::mix(h ^ this->sunk.lo, this->sunk.hi);
+    return Random::mix(h ^ this->afloat, reinterpret_cast<uintptr_t>(this->prior));
+}
+
+// **Constructor**
+HeatmapCache::HeatmapCache(size_t max_bytes, int max_shots, size_t num_shards) : maxShots{max_shots} {
+    if (num_shards == 0)
+        num_shards = 1;
+    this->shardCapacity = max_bytes / num_shards / ENTRY_BYTES;
+    if (this->shardCapacity == 0)
+        this->shardCapacity = 1;
+    for (size_t s = 0; s < num_shards; ++s)
+        this->shards.emplace_back(new Shard());
+}
+
+// **Find**
+bool HeatmapCache::find(const HeatmapKey& key, array<long, 100>& weights) {
+    uint64_t hash = key.hash();
+    Shard& shard = this->shard_for(hash);
+    lock_guard<mutex> guard(shard.lock);
+    ++shard.lookups;
+    auto found = shard.index.find(hash);
+    if (found == shard.index.end())
+        return false;
+    Entry& entry = shard.slots[found->second];
+    if (!(entry.key == key))
+        return false; // Another key with the same hash.
+    entry.referenced = true;
+    for (int i = 0; i < 100; ++i)
+        weights[i] = entry.weights[i];
+    ++shard.hits;
+    return true;
+}
+
+// **Insert**
+// A new key takes a fresh slot while the shard has room; after that, the CLOCK
+// hand sweeps past marked entries, unmarking them, and evicts the first unmarked one.
+void HeatmapCache::insert(const HeatmapKey& key, const array<long, 100>& weights) {
+    for (long weight : weights)
+        if (weight < numeric_limits<int32_t>::min() || weight > numeric_limits<int32_t>::max())
+            return;
+    uint64_t hash = key.hash();
+    Shard& shard = this->shard_for(hash);
+    lock_guard<mutex> guard(shard.lock);
+    uint32_t slot;
+    auto found = shard.index.find(hash);
+    if (found != shard.index.end()) {
+        slot = found->second; // Same key stored by another worker meanwhile, or a colliding one.
+    } else if (shard.slots.size() < this->shardCapacity) {
+        slot = static_cast<uint32_t>(shard.slots.size());
+        if (shard.slots.size() == shard.slots.capacity()) // Grow by doubling, but never past the shard's share.
+            shard.slots.reserve(min(this->shardCapacity, shard.slots.size() * 2 + 16));
+        shard.slots.emplace_back();
+        shard.index.emplace(hash, slot);
+    } else {
+        while (shard.slots[shard.hand].referenced) {
+            shard.slots[shard.hand].referenced = false;
+            shard.hand = (shard.hand + 1) % shard.slots.size();
+        }
+        slot = static_cast<uint32_t>(shard.hand);
+        shard.hand = (shard.hand + 1) % shard.slots.size();
+        shard.index.erase(shard.slots[slot].hash);
+        shard.index.emplace(hash, slot);
+        ++shard.evictions;
+    }
+    Entry& entry = shard.slots[slot];
+    entry.key = key;
+    entry.hash = hash;
+    for (int i = 0; i < 100; ++i)
+        entry.weights[i] = static_cast<int32_t>(weights[i]);
+    entry.referenced = false;
+    ++shard.insertions;
+}
+
+// **Clear**
+void HeatmapCache::clear() {
+    for (const unique_ptr<Shard>& shard : this->shards) {
+        lock_guard<mutex> guard(shard->lock);
+        shard->slots.clear();
+        shard->index.clear();
+        shard->hand = 0;
+        shard->lookups = shard->hits = shard->insertions = shard->evictions = 0;
+    }
+}
+
+// **Statistics**
+// Bytes count each slot's storage and, per index entry, the node and its bucket.
+HeatmapCache::Stats HeatmapCache::getStats() const {
+    Stats stats;
+    for (const unique_ptr<Shard>& shard : this->shards) {
+        lock_guard<mutex> guard(shard->lock);
+        stats.lookups += shard->lookups;
+        stats.hits += shard->hits;
+        stats.insertions += shard->insertions;
+        stats.evictions += shard->evictions;
+        stats.entries += shard->slots.size();
+        stats.bytes += shard->slots.capacity() * sizeof(Entry) + shard->index.bucket_count() * sizeof(void*) +
+                       shard->index.size() * (sizeof(uint64_t) + sizeof(uint32_t) + 2 * sizeof(void*));
+    }
+    stats.capacity = this->shardCapacity * this->shards.size();
+    return stats;
+}
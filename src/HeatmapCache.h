@@ -0,0 +1,119 @@
+#ifndef HEATMAPCACHE_H
+#define HEATMAPCACHE_H
+
+#include "Bitboard.h"       // Observations as sets of spaces.
+#include "PlacementPrior.h" // Part of what a weight depends on.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <unordered_map>
+    using std::unordered_map;
+
+#include <mutex>
+    using std::mutex;
+
+#include <memory>
+    using std::unique_ptr;
+
+#include <cstddef>
+    using std::size_t;
+
+#include <cstdint>
+    using std::int32_t;
+    using std::uint32_t;
+    using std::uint64_t;
+
+// **HeatmapKey Struct**
+// Everything a HARD Camden's space weights depend on. The sunk ships are kept apart
+// from the other hits, since which hits they took changes what is left to explain.
+struct HeatmapKey {
+    Bitboard hits;                          // Every hit, sunk ships included.
+    Bitboard misses;                        // Every miss.
+    Bitboard sunk;                          // Spaces of the sunk ships.
+    uint32_t afloat {0};                    // Bit t set while the ship of ShipType t is afloat.
+    const PlacementPrior* prior {nullptr};  // Hunting weights the heatmap scales by, or nullptr for none.
+
+    uint64_t hash() const;
+    bool operator==(const HeatmapKey& other) const {
+        return this->hits == other.hits && this->misses == other.misses && this->sunk == other.sunk &&
+               this->afloat == other.afloat && this->prior == other.prior;
+    }
+};
+
+// **HeatmapCache Class**
+// Space weights of observation states already seen, shared by every Camden of a
+// batch across the Tournament's workers. Openings repeat from game to game, so a
+// HARD Camden that finds its state here skips bringing its heatmap up to date and
+// weighing it. Later states almost never repeat and would only churn the cache,
+// so only states of at most maxShots shots are kept (12 by default: about three
+// lookups in four hit, where caching every state drops to one in four and runs
+// slower than no cache at all). Keys are spread over shards by hash, each with its
+// own lock, slots and CLOCK hand: a lookup marks its entry, and a full shard evicts
+// the first entry the hand finds unmarked, clearing marks as it passes. Hits return
+// exactly the weights that were stored, so results do not depend on the cache.
+class HeatmapCache {
+    public:
+        // **Statistics**
+        struct Stats {
+            uint64_t lookups {0};    // Calls to find.
+            uint64_t hits {0};       // Lookups that found their key.
+            uint64_t insertions {0}; // Entries stored.
+            uint64_t evictions {0};  // Entries pushed out to make room.
+            size_t entries {0};      // Entries held now.
+            size_t capacity {0};     // Entries the cache can hold.
+            size_t bytes {0};        // Memory held by the slots and indexes, approximately.
+
+            double hitRate() const { return this->lookups ? static_cast<double>(this->hits) / static_cast<double>(this->lookups) : 0.0; }
+        };
+
+    private:
+        struct Entry {
+            HeatmapKey key;
+            uint64_t hash {0};
+            array<int32_t, 100> weights {};
+            bool referenced {false}; // Set by a lookup, cleared by the passing hand.
+        };
+
+        struct Shard {
+            mutable mutex lock;
+            vector<Entry> slots;                    // Grows up to the shard's capacity, then is reused.
+            unordered_map<uint64_t, uint32_t> index; // Hash to slot.
+            size_t hand {0};                        // Next slot the CLOCK hand looks at.
+            uint64_t lookups {0};
+            uint64_t hits {0};
+            uint64_t insertions {0};
+            uint64_t evictions {0};
+        };
+
+        vector<unique_ptr<Shard>> shards;
+        size_t shardCapacity;                       // Entries per shard.
+        int maxShots;                               // Most shots fired in a state worth caching.
+
+        Shard& shard_for(uint64_t hash) const { return *this->shards[(hash >> 32) % this->shards.size()]; }
+
+    public:
+        static constexpr size_t DEFAULT_SHARDS = 64;
+        static constexpr int DEFAULT_MAX_SHOTS = 12;
+        static constexpr size_t ENTRY_BYTES = sizeof(Entry) + 32; // A slot plus its index node, roughly.
+
+        // **Constructor**
+        // Holds about max_bytes of entries, at least one per shard, for states of at most max_shots shots.
+        explicit HeatmapCache(size_t max_bytes, int max_shots = DEFAULT_MAX_SHOTS, size_t num_shards = DEFAULT_SHARDS);
+        HeatmapCache(const HeatmapCache&) = delete;
+        HeatmapCache& operator=(const HeatmapCache&) = delete;
+
+        // **Lookups**
+        bool admits(int num_shots) const { return num_shots <= this->maxShots; } // Whether states this deep are cached.
+        bool find(const HeatmapKey& key, array<long, 100>& weights); // Copies the weights out and returns true if the key is held.
+        void insert(const HeatmapKey& key, const array<long, 100>& weights); // Stores or replaces; weights beyond 32 bits are not kept.
+        void clear();                                                 // Drops every entry and zeroes the counters.
+
+        // **Reporting**
+        Stats getStats() const;
+};
+
+#endif
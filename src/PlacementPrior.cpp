@@ -0,0 +1,102 @@
+#include "PlacementPrior.h"
+
+#include <array>
+    using std::array;
+
+#include <string>
+    using std::string;
+    using std::getline;
+
+#include <fstream>
+    using std::ifstream;
+    using std::ofstream;
+
+#include <sstream>
+    using std::istringstream;
+
+#include <iomanip>
+    using std::setw;
+
+#include <ostream>
+    using std::ostream;
+    using std::endl;
+
+#include <stdexcept>
+    using std::runtime_error;
+
+// **Uniform Constructor**
+PlacementPrior::PlacementPrior() {
+    this->weights.fill(AVERAGE);
+}
+
+// **Constructor from Counts**
+// Scales the counts so that their mean becomes AVERAGE, rounding to the nearest integer.
+PlacementPrior::PlacementPrior(const array<long, 100>& counts) : PlacementPrior() {
+    long total = 0;
+    for(long count : counts)
+        total += count > 0 ? count : 0;
+    if(total == 0)
+        return;
+    for(int i = 0; i < 100; ++i) {
+        long count = counts[i] > 0 ? counts[i] : 0;
+        this->weights[i] = static_cast<int>((count * 100 * AVERAGE + total / 2) / total);
+    }
+}
+
+// **Load a Prior File**
+PlacementPrior PlacementPrior::load(string path) {
+    ifstream in(path);
+    if(!in)
+        throw runtime_error("Cannot read prior " + path);
+    array<long, 100> counts {};
+    int num_read = 0;
+    string line;
+    while(getline(in, line)) {
+        if(line.empty() || line[0] == '#')
+            continue;
+        istringstream numbers(line);
+        for(long value; numbers >> value;) {
+            if(num_read == 100 || value < 0)
+                throw runtime_error("Bad prior " + path);
+            counts[num_read++] = value;
+        }
+    }
+    if(num_read != 100)
+        throw runtime_error("Bad prior " + path + ": expected 100 numbers");
+    return PlacementPrior(counts);
+}
+
+// **Save a Prior File**
+void PlacementPrior::save(string path, string comment) const {
+    ofstream out(path);
+    if(!out)
+        throw runtime_error("Cannot write prior " + path);
+    out << "# battleship2 placement prior, " << AVERAGE << " = average space" << endl;
+    if(!comment.empty())
+        out << "# " << comment << endl;
+    this->print(out);
+    if(!out)
+        throw runtime_error("Cannot write prior " + path);
+}
+
+// **Print the Rows**
+void PlacementPrior::print(ostream& out) const {
+    for(int row_index = 0; row_index < 10; ++row_index) {
+        for(int column_index = 0; column_index < 10; ++column_index)
+            out << (column_index ? " " : "") << setw(5) << this->weights[row_index * 10 + column_index];
+        out << endl;
+    }
+}
+
+// **Weight of a Space**
+int PlacementPrior::weight(SpaceName space_name) const {
+    return this->weights[static_cast<int>(space_name) - 1];
+}
+
+// **Uniform Check**
+bool PlacementPrior::isUniform() const {
+    for(int weight : this->weights)
+        if(weight != AVERAGE)
+            return false;
+    return true;
+}
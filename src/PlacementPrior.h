@@ -0,0 +1,43 @@
+#ifndef PLACEMENTPRIOR_H
+#define PLACEMENTPRIOR_H
+
+#include "Enums.h"  // SpaceName.
+
+#include <array>
+    using std::array;
+
+#include <string>
+    using std::string;
+
+#include <ostream>
+    using std::ostream;
+
+// **PlacementPrior Class**
+// How often each space of a grid held a ship, relative to the average space, as
+// learned from recorded games. Weights are integers with 1000 for an average space,
+// so a HARD Camden can scale its placement counts by them without floating point.
+// A prior file has one line per row, ten numbers a line, plus comment lines
+// starting with '#'; any non-negative scale will do, as loading rescales it.
+class PlacementPrior {
+    private:
+        array<int, 100> weights;  // Weight of each space by bit index; 1000 is average.
+
+    public:
+        static constexpr int AVERAGE = 1000; // Weight of a space that holds ships as often as the average one.
+
+        // **Constructors**
+        PlacementPrior();                                    // Every space average.
+        explicit PlacementPrior(const array<long, 100>& counts); // Weights proportional to the counts; all average if they are all 0.
+
+        // **Files**
+        static PlacementPrior load(string path);             // Reads a prior file; throws runtime_error if it has not 100 numbers.
+        void save(string path, string comment = "") const;   // Writes a prior file; throws runtime_error on failure.
+        void print(ostream& out) const;                      // Writes the ten rows.
+
+        // **Queries**
+        int weight(SpaceName space_name) const;              // Weight of a space.
+        int weightAt(int index) const { return this->weights[index]; } // Weight by bit index, for the heatmap's inner loop.
+        bool isUniform() const;                              // True if every space is average.
+};
+
+#endif
@@ -0,0 +1,102 @@
+/* Placements lists, at compile time, every way to lay a ship of length 2 to 5 on the
+10x10 grid. Each Placement carries the ship's spaces and its halo (the spaces
+orthogonally next to it) as Bitboards, so checking a placement against a grid is a
+single AND instead of a walk over space strings. */
+
+#ifndef PLACEMENTS_H // Include guard to prevent multiple inclusions.
+#define PLACEMENTS_H
+
+#include <array> // Include for using array class.
+    using std::array; // Use array from the standard namespace.
+
+#include "Enums.h" // Include for the SpaceName enumeration.
+#include "Bitboard.h" // Include for the space masks.
+
+// Declaration of the Placement struct, one ship laid on the grid.
+struct Placement {
+    Bitboard mask; // Spaces the ship covers; empty if it would run off the grid.
+    Bitboard halo; // Spaces orthogonally next to the ship.
+    SpaceName start {NO_SPACE}; // Space of the ship's first stud.
+    int step {0}; // Index change from one stud to the next (-10 N, 10 S, 1 E, -1 W).
+
+    constexpr bool fits() const { return this->mask.any(); } // Checks if the ship stays on the grid.
+    constexpr SpaceName spaceAt(int i) const { return static_cast<SpaceName>(this->start + i * this->step); } // Space of stud i.
+    constexpr char direction() const { // Direction from the start space to the other studs.
+        return this->step == -10 ? 'N' : this->step == 10 ? 'S' : this->step == 1 ? 'E' : 'W';
+    }
+};
+
+// Struct containing the placement tables and lookups.
+struct Placements {
+    static constexpr int MIN_LENGTH = 2; // Shortest ship (Cruiser).
+    static constexpr int MAX_LENGTH = 5; // Longest ship (Carrier).
+    static constexpr int NUM_LENGTHS = MAX_LENGTH - MIN_LENGTH + 1; // Lengths covered by the tables.
+    static constexpr int MAX_LINES = 180; // Distinct placements of the shortest ship.
+
+    // Index of a direction in the start table, or -1 if it is not N, S, E or W.
+    static constexpr int directionIndex(char direction) {
+        switch (direction) {
+            case 'N': return 0;
+            case 'S': return 1;
+            case 'E': return 2;
+            case 'W': return 3;
+            default: return -1;
+        }
+    }
+
+    // The placement of a ship of the given length from a start space in a direction (off-grid runs stay empty).
+    static constexpr Placement make(int length, SpaceName start, char direction) {
+        constexpr int steps[] = {-10, 10, 1, -1};
+        int column_index = Spaces::columnIndex(start) + (direction == 'E' ? length - 1 : direction == 'W' ? 1 - length : 0);
+        int row_index = Spaces::rowIndex(start) + (direction == 'S' ? length - 1 : direction == 'N' ? 1 - length : 0);
+        Placement placement;
+        if (column_index < 0 || column_index > 9 || row_index < 0 || row_index > 9)
+            return placement;
+        placement.start = start;
+        placement.step = steps[directionIndex(direction)];
+        for (int i = 0; i < length; ++i)
+            placement.mask |= Bitboard::of(placement.spaceAt(i));
+        placement.halo = placement.mask.neighbors();
+        return placement;
+    }
+
+    // Both lookup tables, filled in at compile time.
+    struct Table {
+        array<array<Placement, 400>, NUM_LENGTHS> byStart {}; // [length][(start - 1) * 4 + direction]
+        array<array<Placement, MAX_LINES>, NUM_LENGTHS> lines {}; // Distinct placements, each running E or S.
+        array<int, NUM_LENGTHS> lineCounts {}; // Used entries of lines.
+    };
+    static constexpr Table build() {
+        Table table;
+        constexpr char directions[] = {'N', 'S', 'E', 'W'};
+        for (int length_index = 0; length_index < NUM_LENGTHS; ++length_index) {
+            int length = length_index + MIN_LENGTH;
+            for (int i = 0; i < 100; ++i) {
+                SpaceName start = static_cast<SpaceName>(i + 1);
+                for (int d = 0; d < 4; ++d)
+                    table.byStart[length_index][i * 4 + d] = make(length, start, directions[d]);
+                for (char direction : {'E', 'S'}) {
+                    Placement placement = table.byStart[length_index][i * 4 + directionIndex(direction)];
+                    if (placement.fits())
+                        table.lines[length_index][table.lineCounts[length_index]++] = placement;
+                }
+            }
+        }
+        return table;
+    }
+    static const Table table; // Defined below, once the struct is complete.
+
+    // Lookups.
+    static constexpr const Placement& at(int length, SpaceName start, char direction) { // Empty if off-grid or a bad direction.
+        int d = directionIndex(direction);
+        return d < 0 ? table.byStart[0][0 * 4 + 0] // A1 running north never fits; used as the empty placement.
+                     : table.byStart[length - MIN_LENGTH][(start - 1) * 4 + d];
+    }
+    static constexpr int count(int length) { return table.lineCounts[length - MIN_LENGTH]; } // Distinct placements of a length.
+    static constexpr const Placement* begin(int length) { return table.lines[length - MIN_LENGTH].data(); } // First distinct placement.
+    static constexpr const Placement* end(int length) { return begin(length) + count(length); } // Past the last distinct placement.
+};
+
+inline constexpr Placements::Table Placements::table = Placements::build();
+
+#endif // End of include guard.
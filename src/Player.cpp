@@ -1,10 +1,12 @@
 #include "Player.h"
 
+#include "Arena.h"
 #include "Battleship.h"
 #include "Carrier.h"
 #include "Cruiser.h"
 #include "Destroyer.h"
 #include "Enums.h"
+#include "FleetGenerator.h"
 #include "Grid.h"
 #include "Ship.h"
 #include "Submarine.h"
@@ -26,6 +28,7 @@
 #include <stdexcept>
     using std::domain_error;
     using std::out_of_range;
+    using std::logic_error;
 
 // **Constructors and Destructor**
 
@@ -33,16 +36,16 @@
 Player::Player() {}
 
 // Constructor that initializes player type (CPU or MAN).
-Player::Player(PlayerType player_type) : type {player_type} {
+Player::Player(PlayerType player_type, Arena* the_arena) : type {player_type}, arena {the_arena} {
     if (player_type == CPU) {
         this->name = "Camden"; // Default name for CPU player.
     }
-    this->grid = new Grid(player_type); // Initialize grid based on player type.
+    this->grid = Arena::make<Grid>(this->arena, player_type, this->arena); // Initialize grid based on player type.
 }
 
 // Constructor that initializes player type and name.
-Player::Player(PlayerType player_type, string player_name) : type {player_type}, name {player_name} {
-    this->grid = new Grid(player_type); // Initialize grid.
+Player::Player(PlayerType player_type, string player_name, Arena* the_arena) : type {player_type}, name {player_name}, arena {the_arena} {
+    this->grid = Arena::make<Grid>(this->arena, player_type, this->arena); // Initialize grid.
 }
 
 // Constructor that initializes player type, name, and opponent.
@@ -53,16 +56,13 @@ Player::Player(PlayerType player_type, string player_name, Player* the_foe) : ty
 
 // Destructor to clean up resources.
 Player::~Player() {
-    this->floatingShips.clear(); // Clear the list of floating ships.
-    this->sunkenShips.clear(); // Clear the list of sunken ships.
-
     // Delete and nullify ships.
     for (size_t i = 0; i < this->ships.size(); ++i) {
-        delete this->ships[i];
+        Arena::destroy(this->arena, this->ships[i]);
         this->ships[i] = nullptr;
     }
 
-    delete this->grid; // Delete grid.
+    Arena::destroy(this->arena, this->grid); // Delete grid.
     this->grid = nullptr;
 
     this->foe = nullptr; // Nullify opponent reference.
@@ -75,18 +75,24 @@ string Player::getName() const { return this->name; }
 Grid* Player::getGrid() & { return this->grid; }
 Player* Player::getFoe() const { return this->foe; }
 Grid* Player::getFoeGrid() & { return this->foeGrid; }
-array<Ship*, 5> Player::getShips() const { return this->ships; }
-vector<Ship*> Player::getFloatingShips() const { return this->floatingShips; }
-vector<Ship*> Player::getSunkenShips() const { return this->sunkenShips; }
-vector<string> Player::getTargetedSpaces() const { return this->targetedSpaces; }
-vector<string> Player::getHitSpaces() const { return this->hitSpaces; }
-vector<string> Player::getMissSpaces() const { return this->missSpaces; }
-vector<char> Player::getHMHist() const { return this->HMHist; }
+const array<Ship*, 5>& Player::getShips() const { return this->ships; }
+int Player::getNumFloatingShips() const { return this->numFloating; }
+int Player::getNumSunkenShips() const { return this->numSunk; }
+int Player::getNumShots() const { return this->numShots; }
+SpaceName Player::getShot(int shot_index) const { return static_cast<SpaceName>(this->shotLog[shot_index] + 1); }
+Bitboard Player::getShotHits() const { return this->shotHits; }
+Bitboard Player::getShotMisses() const { return this->shotMisses; }
+View<uint8_t> Player::viewShotLog() const { return View<uint8_t>(this->shotLog.data(), static_cast<size_t>(this->numShots)); }
+View<Ship*> Player::viewFloatingShips() const { return View<Ship*>(this->floatingShips.data(), static_cast<size_t>(this->numFloating)); }
+View<Ship*> Player::viewSunkenShips() const { return View<Ship*>(this->sunkenShips.data(), static_cast<size_t>(this->numSunk)); }
+vector<Ship*> Player::getFloatingShips() const { return this->viewFloatingShips().toVector(); }
+vector<Ship*> Player::getSunkenShips() const { return this->viewSunkenShips().toVector(); }
 
 void Player::setPlayerType(PlayerType player_type) { this->type = player_type; }
 void Player::setName(string player_name) { this->name = player_name; }
 void Player::setFoe(Player* the_foe) { this->foe = the_foe; }
 void Player::setFoeGrid(Grid* the_grid) { this->foeGrid = the_grid; }
+void Player::setQuiet(bool is_quiet) { this->isQuiet = is_quiet; }
 
 // Sets the player's opponent and their grid.
 void Player::makeFoe(Player* &the_foe) {
@@ -94,37 +100,62 @@ void Player::makeFoe(Player* &the_foe) {
     this->foeGrid = the_foe->getGrid();
 }
 
+// **Shot History**
+// Shots are kept as two masks and a log of bit indices; the string and char lists
+// are rebuilt from them only when asked for.
+
+vector<string> Player::getTargetedSpaces() const {
+    vector<string> targeted_spaces;
+    targeted_spaces.reserve(static_cast<size_t>(this->numShots));
+    for (int i = 0; i < this->numShots; ++i)
+        targeted_spaces.push_back(Spaces::stringFromName(this->getShot(i)));
+    return targeted_spaces;
+}
+
+vector<string> Player::getHitSpaces() const {
+    vector<string> hit_spaces;
+    for (int i = 0; i < this->numShots; ++i)
+        if (this->shotHits.test(this->shotLog[i]))
+            hit_spaces.push_back(Spaces::stringFromName(this->getShot(i)));
+    return hit_spaces;
+}
+
+vector<string> Player::getMissSpaces() const {
+    vector<string> miss_spaces;
+    for (int i = 0; i < this->numShots; ++i)
+        if (this->shotMisses.test(this->shotLog[i]))
+            miss_spaces.push_back(Spaces::stringFromName(this->getShot(i)));
+    return miss_spaces;
+}
+
+vector<char> Player::getHMHist() const {
+    vector<char> hm_hist;
+    hm_hist.reserve(static_cast<size_t>(this->numShots));
+    for (int i = 0; i < this->numShots; ++i)
+        hm_hist.push_back(this->shotHits.test(this->shotLog[i]) ? 'H' : 'M');
+    return hm_hist;
+}
+
 // **Ship State and Status Methods**
 
+// The fleet bits are indexed by ShipType, and ships[] holds at most one ship of each type,
+// so every check below is a lookup rather than a search.
 bool Player::hasShip(Ship* ship) const {
-    for (Ship* the_ship : this->ships)
-        if (ship == the_ship)
-            return true;
-    return false;
+    return ship != nullptr && this->ships[ship->getShipType()] == ship;
 }
 
 bool Player::shipIsFloating(Ship* ship) const {
-    if (!this->hasShip(ship))
-        return false;
-    for (Ship* the_ship : this->floatingShips)
-        if (ship == the_ship)
-            return true;
-    return false;
+    return this->hasShip(ship) && (this->floatingFleet & (1u << ship->getShipType()));
 }
 
 bool Player::shipIsSunken(Ship* ship) const {
-    if (!this->hasShip(ship))
-        return false;
-    for (Ship* the_ship : this->sunkenShips)
-        if (ship == the_ship)
-            return true;
-    return false;
+    return this->hasShip(ship) && (this->sunkenFleet & (1u << ship->getShipType()));
 }
 
 // Prints a list of ships still afloat.
 void Player::stillFloating() const {
     cout << "\nShips still afloat:\n";
-    for (Ship* ship : this->floatingShips)
+    for (Ship* ship : this->viewFloatingShips())
         cout << ship->getShipName() << endl;
     cout << endl;
 }
@@ -132,7 +163,7 @@ void Player::stillFloating() const {
 // Prints a list of opponent's ships not sunk yet.
 void Player::notSunkYet() const {
     cout << "\nOpponent's unsunk ships:\n";
-    for (Ship* ship : this->foe->getFloatingShips())
+    for (Ship* ship : this->foe->viewFloatingShips())
         cout << ship->getShipName() << endl;
     cout << endl;
 }
@@ -151,15 +182,42 @@ void Player::showOwn() const {
     cout << endl;
 }
 
+// Returns the first floating ship whose studs have all been hit, or nullptr.
+Ship* Player::justSunkenShip() const {
+    for (Ship* ship : this->viewFloatingShips())
+        if (ship->wasSunk())
+            return ship;
+    return nullptr;
+}
+
+// Moves a ship from the floating fleet to the sunken fleet.
+// The floating ships close up behind it to keep placement order (at most four moves).
+void Player::sinkShip(Ship* ship) {
+    if (!this->shipIsFloating(ship))
+        return;
+    unsigned ship_bit = 1u << ship->getShipType();
+    this->floatingFleet &= ~ship_bit;
+    this->sunkenFleet |= ship_bit;
+    int i = 0;
+    while (this->floatingShips[i] != ship)
+        ++i;
+    for (--this->numFloating; i < this->numFloating; ++i)
+        this->floatingShips[i] = this->floatingShips[i + 1];
+    this->floatingShips[this->numFloating] = nullptr;
+    this->sunkenShips[this->numSunk++] = ship;
+}
+
 // Checks if a space was already targeted.
 bool Player::spaceWasTargeted(string space) const {
-    for (string the_space : this->targetedSpaces)
-        if (space == the_space)
-            return true;
-    return false;
+    return Spaces::isSpaceString(space) && this->spaceWasTargeted(Spaces::nameFromString(space));
 }
 
-// Processes the result of a targeting attempt.
+// Checks if a space was already targeted, given its SpaceName.
+bool Player::spaceWasTargeted(SpaceName space) const {
+    return (this->shotHits | this->shotMisses).has(space); // One bit test on the player's own shot masks.
+}
+
+// Validates a typed space string and targets it.
 bool Player::target(string space, bool do_cout) {
     if (this->foeGrid == nullptr)
         throw domain_error("Foe grid not set.");
@@ -168,9 +226,16 @@ bool Player::target(string space, bool do_cout) {
         if (do_cout) cout << "Invalid entry." << endl;
         return false;
     }
+    return this->target(Spaces::nameFromString(space), do_cout);
+}
+
+// Processes the result of a targeting attempt.
+bool Player::target(SpaceName space, bool do_cout) {
+    if (this->foeGrid == nullptr)
+        throw domain_error("Foe grid not set.");
 
     if (this->spaceWasTargeted(space)) {
-        if (do_cout) cout << "Space already targeted." << endl;
+        if (do_cout && !this->isQuiet) cout << "Space already targeted." << endl;
         return false;
     }
 
@@ -178,22 +243,22 @@ bool Player::target(string space, bool do_cout) {
     try {
         shot = this->foeGrid->target(space);
     } catch (std::exception& e) {
-        cout << e.what() << endl;
+        if (!this->isQuiet) cout << e.what() << endl;
         return false;
     }
 
-    this->targetedSpaces.push_back(space);
+    this->shotLog[this->numShots++] = static_cast<uint8_t>(space - 1); // A space can only be shot once, so 100 entries suffice.
     if (shot == MISS) {
-        this->missSpaces.push_back(space);
-        this->HMHist.push_back('M');
-        cout << "Miss" << endl;
+        this->shotMisses |= Bitboard::of(space);
+        if (!this->isQuiet) cout << "Miss" << endl;
     } else if (shot == HIT) {
-        this->hitSpaces.push_back(space);
-        this->HMHist.push_back('H');
-        cout << "Hit" << endl;
-        Ship* sunk_ship = this->foe->justSunkenShip();
+        this->shotHits |= Bitboard::of(space);
+        if (!this->isQuiet) cout << "Hit" << endl;
+        Ship* hit_ship = this->foeGrid->getSpace(space)->getStud()->getOfShip();
+        Ship* sunk_ship = hit_ship->wasSunk() ? hit_ship : nullptr; // The ship's own hit counter says whether it went down.
         if (sunk_ship != nullptr) {
-            cout << this->foe->getName() << "'s " << sunk_ship->getShipName() << " has been sunk!" << endl;
+            if (!this->isQuiet)
+                cout << this->foe->getName() << "'s " << sunk_ship->getShipName() << " has been sunk!" << endl;
             this->foe->sinkShip(sunk_ship);
         }
     }
@@ -221,9 +286,45 @@ bool Player::processInput(string input) {
 }
 
 bool Player::allShipsAreSunk() const {
-    return this->floatingShips.empty() && this->sunkenShips.size() == 5;
+    return this->numSunk > 0 && this->numFloating == 0; // Every placed ship has been sunk.
+}
+
+// Prompts for a start space and direction until the ship is placed, then records it.
+void Player::set_ship(Ship* ship) {
+    string start_space;
+    char direction;
+    do {
+        cout << "Enter " << ship->getShipName() << " Start Space: ";
+        cin >> start_space;
+        while (!Spaces::isSpaceString(start_space) || this->grid->isNoGoSpace(start_space)) {
+            if (!Spaces::isSpaceString(start_space))
+                cout << "Invalid Space." << endl;
+            else
+                cout << "Space is occupied by or adjacent to an existing Ship. Please choose another space." << endl;
+            cout << "Enter " << ship->getShipName() << " Start Space: ";
+            cin >> start_space;
+        }
+        cout << "Enter " << ship->getShipName() << " Direction: ";
+        cin >> direction;
+        while (direction != 'N' && direction != 'S' && direction != 'E' && direction != 'W') {
+            cout << "Invalid Direction." << endl;
+            cout << "Enter " << ship->getShipName() << " Direction: ";
+            cin >> direction;
+        }
+        ship->setIsReady(ship->placeOnGrid(start_space, direction));
+    } while (!ship->getIsReady());
+    this->record_ship(ship);
+    cout << "" << endl;
+    this->grid->showGrid();
+    cout << "" << endl;
 }
 
+void Player::setCarrier() { this->set_ship(this->ship_of(CARRIER)); }
+void Player::setBattleship() { this->set_ship(this->ship_of(BATTLESHIP)); }
+void Player::setDestroyer() { this->set_ship(this->ship_of(DESTROYER)); }
+void Player::setSubmarine() { this->set_ship(this->ship_of(SUBMARINE)); }
+void Player::setCruiser() { this->set_ship(this->ship_of(CRUISER)); }
+
 // Sets up ships manually.
 void Player::manuallySetShips() {
     this->setCarrier();
@@ -233,13 +334,97 @@ void Player::manuallySetShips() {
     this->setCruiser();
 }
 
+// Tries random start spaces and directions until the ship fits, then records it.
+void Player::autoPutShip(Ship* ship, Random& rand_func) {
+    char directions[] = {'N', 'S', 'E', 'W'};
+    while (!ship->getIsReady()) {
+        SpaceName start_space = Spaces::spaceNames[rand_func() % 100];
+        char direction = directions[rand_func() % 4];
+        ship->setIsReady(ship->placeOnGrid(start_space, direction, false));
+    }
+    this->record_ship(ship);
+}
+
+// Creates the ship named by its label character and places it at random.
+void Player::autoSetShip(char ship_char, Random& rand_func) {
+    switch (ship_char) {
+        case 'A':
+            this->autoPutShip(this->ship_of(CARRIER), rand_func);
+            break;
+        case 'B':
+            this->autoPutShip(this->ship_of(BATTLESHIP), rand_func);
+            break;
+        case 'C':
+            this->autoPutShip(this->ship_of(CRUISER), rand_func);
+            break;
+        case 'D':
+            this->autoPutShip(this->ship_of(DESTROYER), rand_func);
+            break;
+        case 'S':
+            this->autoPutShip(this->ship_of(SUBMARINE), rand_func);
+            break;
+    }
+}
+
+// Returns the ship of a type, building it the first time. A reset keeps the ship and its
+// studs, so later games place the same objects again.
+Ship* Player::ship_of(ShipType ship_type) {
+    if (this->ships[ship_type] != nullptr)
+        return this->ships[ship_type];
+    switch (ship_type) {
+        case CARRIER: return Arena::make<Carrier>(this->arena, this->grid);
+        case BATTLESHIP: return Arena::make<Battleship>(this->arena, this->grid);
+        case DESTROYER: return Arena::make<Destroyer>(this->arena, this->grid);
+        case SUBMARINE: return Arena::make<Submarine>(this->arena, this->grid);
+        case CRUISER: return Arena::make<Cruiser>(this->arena, this->grid);
+    }
+    throw domain_error("Unknown ship type.");
+}
+
+// Adds a ship that was just placed to the floating fleet.
+void Player::record_ship(Ship* ship) {
+    this->ships[ship->getShipType()] = ship;
+    this->floatingShips[this->numFloating++] = ship;
+    this->floatingFleet |= 1u << ship->getShipType();
+}
+
+// Places a ship on the space and direction given by a generated fleet.
+void Player::put_ship(Ship* ship, const Placement& placement) {
+    ship->setIsReady(ship->placeOnGrid(placement.start, placement.direction(), false));
+    if (!ship->getIsReady())
+        throw logic_error("Generated placement does not fit the grid.");
+    this->record_ship(ship);
+}
+
 // Automatically places ships on the grid.
-void Player::autoSetShips(int(*rand_func)()) {
-    this->autoSetShip('A', rand_func);
-    this->autoSetShip('B', rand_func);
-    this->autoSetShip('D', rand_func);
-    this->autoSetShip('S', rand_func);
-    this->autoSetShip('C', rand_func);
+// The whole fleet is drawn on masks first, so no placement is tried and rejected on the grid.
+void Player::autoSetShips(Random& rand_func, FleetMode fleet_mode) {
+    this->setFleet(FleetGenerator::generate(rand_func, fleet_mode));
+}
+
+// Places every ship where the fleet has it, in the order autoSetShips always has.
+void Player::setFleet(const Fleet& fleet) {
+    this->put_ship(this->ship_of(CARRIER), fleet.ships[CARRIER]);
+    this->put_ship(this->ship_of(BATTLESHIP), fleet.ships[BATTLESHIP]);
+    this->put_ship(this->ship_of(DESTROYER), fleet.ships[DESTROYER]);
+    this->put_ship(this->ship_of(SUBMARINE), fleet.ships[SUBMARINE]);
+    this->put_ship(this->ship_of(CRUISER), fleet.ships[CRUISER]);
+}
+
+// Asks whether ships should be placed automatically or by hand.
+void Player::askToSetShips(Random& rand_func) {
+    char answer;
+    cout << "Auto set ships ? (y/n) > ";
+    cin >> answer;
+    while (answer != 'y' && answer != 'n') {
+        cout << "Invalid response. Please enter y or n." << endl;
+        cout << "Auto set ships (y/n) > ";
+        cin >> answer;
+    }
+    if (answer == 'y')
+        this->autoSetShips(rand_func);
+    else
+        this->manuallySetShips();
 }
 
 // Executes the player's turn.
@@ -252,3 +437,24 @@ void Player::doTurn() {
         input_result = this->processInput(user_input);
     } while (!input_result);
 }
+
+// **Replay**
+
+// Puts the player back to where the constructor left it: an empty grid, no ships placed
+// and no shots fired. Ships, studs and grid spaces are kept for the next placement, and
+// the lists are cleared rather than rebuilt, so a new game allocates nothing.
+void Player::reset() {
+    this->grid->reset();
+    for (Ship* ship : this->ships)
+        if (ship != nullptr)
+            ship->reset();
+    this->floatingShips.fill(nullptr);
+    this->sunkenShips.fill(nullptr);
+    this->numFloating = 0;
+    this->numSunk = 0;
+    this->floatingFleet = 0;
+    this->sunkenFleet = 0;
+    this->shotHits = Bitboard();
+    this->shotMisses = Bitboard();
+    this->numShots = 0;
+}
@@ -10,6 +10,11 @@
 #include "Destroyer.h"
 #include "Submarine.h"
 #include "Cruiser.h"
+#include "Random.h"
+#include "FleetGenerator.h"
+#include "Arena.h"
+#include "Bitboard.h"
+#include "View.h"
 
 #include <array>      // For fixed-size arrays.
     using std::array;
@@ -17,6 +22,8 @@
     using std::vector;
 #include <string>     // For string handling.
     using std::string;
+#include <cstdint>    // For the 1-byte shot log entries.
+    using std::uint8_t;
 
 // The Player class represents a player in the game, either human or CPU.
 class Player {
@@ -25,21 +32,32 @@ class Player {
         PlayerType type;                     // Type of the player: MAN (human) or CPU.
         string name;                         // Name of the player.
         Grid* grid {nullptr};                // Grid representing the player's board.
+        Arena* arena {nullptr};              // Allocator of the grid and ships, or nullptr for the heap.
         Player* foe {nullptr};               // Pointer to the opponent player.
         Grid* foeGrid {nullptr};             // Grid representing the opponent's board.
-        array<Ship*, 5> ships;               // Array of pointers to the player's ships.
-        vector<Ship*> floatingShips;         // Ships that are still floating (not sunk).
-        vector<Ship*> sunkenShips;           // Ships that have been sunk.
-        vector<string> targetedSpaces;       // List of spaces that the player has targeted.
-        vector<string> hitSpaces;            // List of spaces where the player scored a hit.
-        vector<string> missSpaces;           // List of spaces where the player missed.
-        vector<char> HMHist;                 // History of hits ('H') and misses ('M').
+        array<Ship*, 5> ships {};            // Array of pointers to the player's ships.
+        array<Ship*, 5> floatingShips {};    // Ships still afloat, in the order they were placed; the first numFloating are used.
+        array<Ship*, 5> sunkenShips {};      // Ships sunk, in the order they were sunk; the first numSunk are used.
+        int numFloating {0};                 // Number of ships afloat.
+        int numSunk {0};                     // Number of ships sunk.
+        unsigned floatingFleet {0};          // Bit t set while the ship of ShipType t is placed and afloat.
+        unsigned sunkenFleet {0};            // Bit t set once the ship of ShipType t has been sunk.
+        Bitboard shotHits;                   // Spaces where the player scored a hit.
+        Bitboard shotMisses;                 // Spaces where the player missed.
+        array<uint8_t, 100> shotLog {};      // Bit index (SpaceName - 1) of each shot, in the order fired.
+        int numShots {0};                    // Number of shots in the log.
+        bool isQuiet {false};                // True to suppress all console output (headless games).
+
+        void set_ship(Ship* ship);           // Prompts for and places one ship by hand.
+        void put_ship(Ship* ship, const Placement& placement); // Places one ship where a generated fleet has it.
+        Ship* ship_of(ShipType ship_type);   // The player's ship of a type, built on first use and kept across games.
+        void record_ship(Ship* ship);        // Records a ship that was just placed as part of the floating fleet.
 
     public:
         // Constructors
         Player();                                        // Default constructor.
-        explicit Player(PlayerType player_type);         // Constructor with player type.
-        Player(PlayerType player_type, string player_name); // Constructor with type and name.
+        explicit Player(PlayerType player_type, Arena* the_arena = nullptr); // Constructor with player type.
+        Player(PlayerType player_type, string player_name, Arena* the_arena = nullptr); // Constructor with type and name.
         Player(PlayerType player_type, string player_name, Player* the_foe); // Constructor with type, name, and foe.
 
         // Destructor
@@ -51,19 +69,29 @@ class Player {
         Grid* getGrid()&;                               // Gets the player's grid.
         Player* getFoe() const;                         // Gets the pointer to the opponent player.
         Grid* getFoeGrid()&;                            // Gets the grid of the opponent player.
-        array<Ship*, 5> getShips() const;               // Gets the array of player's ships.
-        vector<Ship*> getFloatingShips() const;         // Gets the list of floating ships.
-        vector<Ship*> getSunkenShips() const;           // Gets the list of sunken ships.
-        vector<string> getTargetedSpaces() const;       // Gets the list of targeted spaces.
-        vector<string> getHitSpaces() const;            // Gets the list of hit spaces.
-        vector<string> getMissSpaces() const;           // Gets the list of missed spaces.
-        vector<char> getHMHist() const;                 // Gets the hit/miss history.
+        const array<Ship*, 5>& getShips() const;        // Gets the array of player's ships, indexed by ShipType.
+        vector<Ship*> getFloatingShips() const;         // Gets a copy of the floating ships, in placement order.
+        vector<Ship*> getSunkenShips() const;           // Gets a copy of the sunken ships, in sinking order.
+        View<Ship*> viewFloatingShips() const;          // Views the floating ships without copying them.
+        View<Ship*> viewSunkenShips() const;            // Views the sunken ships without copying them.
+        int getNumFloatingShips() const;                // Gets the number of ships still afloat.
+        int getNumSunkenShips() const;                  // Gets the number of ships sunk.
+        vector<string> getTargetedSpaces() const;       // Gets the list of targeted spaces, built from the shot log.
+        vector<string> getHitSpaces() const;            // Gets the list of hit spaces, built from the shot log.
+        vector<string> getMissSpaces() const;           // Gets the list of missed spaces, built from the shot log.
+        vector<char> getHMHist() const;                 // Gets the hit/miss history, built from the shot log.
+        int getNumShots() const;                        // Gets the number of shots fired.
+        SpaceName getShot(int shot_index) const;        // Gets the space of a shot, counting from 0.
+        Bitboard getShotHits() const;                   // Gets the spaces hit as a mask.
+        Bitboard getShotMisses() const;                 // Gets the spaces missed as a mask.
+        View<uint8_t> viewShotLog() const;              // Views the bit index of every shot, in the order fired.
 
         // Setter Methods
         void setPlayerType(PlayerType player_type);     // Sets the player type.
         void setName(string name);                      // Sets the player's name.
         void setFoe(Player* the_foe);                   // Sets the opponent player.
         void setFoeGrid(Grid* the_grid);                // Sets the opponent's grid.
+        void setQuiet(bool is_quiet);                   // Turns console output off for headless games.
 
         // Gameplay Interaction
         void makeFoe(Player* &the_foe);                 // Links the opponent player and their grid.
@@ -85,7 +113,9 @@ class Player {
 
         // Targeting Methods
         bool spaceWasTargeted(string space) const;     // Checks if a space has been targeted.
-        bool target(string space, bool do_cout = true);// Targets a space during gameplay.
+        bool spaceWasTargeted(SpaceName space) const;  // Checks if a space has been targeted, by SpaceName.
+        bool target(string space, bool do_cout = true);// Targets a space typed at the console.
+        bool target(SpaceName space, bool do_cout = true); // Targets a space during gameplay.
         bool processInput(string input);               // Processes input commands during gameplay.
 
         // Game Completion Check
@@ -100,13 +130,17 @@ class Player {
         void manuallySetShips();                       // Allows manual placement of all ships.
 
         // Automatic Ship Placement
-        void autoPutShip(Ship* ship, int(*rand_func)());// Automatically places a single ship.
-        void autoSetShip(char ship_char, int(*rand_func)()); // Automatically places a specific ship type.
-        void autoSetShips(int(*rand_func)());          // Automatically places all ships.
+        void autoPutShip(Ship* ship, Random& rand_func);// Automatically places a single ship.
+        void autoSetShip(char ship_char, Random& rand_func); // Automatically places a specific ship type.
+        void autoSetShips(Random& rand_func, FleetMode fleet_mode = SEQUENTIAL); // Automatically places all ships from a generated fleet.
+        void setFleet(const Fleet& fleet);             // Places all ships where a legal fleet has them.
 
         // Turn Management
-        void askToSetShips(int(*rand_func)());         // Prompts the player to set ships (manual or automatic).
+        void askToSetShips(Random& rand_func);         // Prompts the player to set ships (manual or automatic).
         void doTurn();                                 // Executes the player's turn.
+
+        // Replay
+        void reset();                                  // Clears the grid, ships and shot history for a new game.
 };
 
 #endif
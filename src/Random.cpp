@@ -0,0 +1,30 @@
+#include "Random.h" // Include Random header file.
+
+#include <cstdint> // Include for fixed-width integer types.
+    using std::uint64_t; // Use uint64_t from the standard namespace.
+
+// Helper: One step of SplitMix64, used to spread a seed over the engine state.
+static uint64_t split_mix(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Constructor: Seeds the engine.
+Random::Random(uint64_t seed) {
+    this->setSeed(seed);
+}
+
+// Method: Expands a 64-bit seed into the 256-bit state. Any seed, including 0, gives a valid state.
+void Random::setSeed(uint64_t seed) {
+    for(uint64_t& word : this->state)
+        word = split_mix(seed);
+}
+
+// Method: Derives the seed of stream `stream` (e.g. game number) from a base seed.
+uint64_t Random::mix(uint64_t seed, uint64_t stream) {
+    uint64_t x = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+    split_mix(x);
+    return split_mix(x);
+}
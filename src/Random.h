@@ -0,0 +1,44 @@
+/* A Random is a self-contained pseudo-random engine (xoshiro256**). Each thread or
+game owns its own Random, so games can run in parallel and be replayed from a seed.
+It is called like rand() and returns values from 0 to 2147483647. */
+
+#ifndef RANDOM_H // Include guard to prevent multiple inclusions.
+#define RANDOM_H
+
+#include <cstdint> // Include for fixed-width integer types.
+    using std::uint64_t; // Use uint64_t from the standard namespace.
+
+// Declaration of the Random class.
+class Random {
+    private:
+        uint64_t state[4]; // Engine state; never all zero.
+
+        static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); } // Rotates x left by k bits.
+
+    public:
+        // Constructor.
+        explicit Random(uint64_t seed = 0); // Seeds the engine (see setSeed).
+
+        // Methods to seed the engine.
+        void setSeed(uint64_t seed); // Expands a 64-bit seed into the full state with SplitMix64.
+        static uint64_t mix(uint64_t seed, uint64_t stream); // Derives an independent seed for stream number `stream`.
+
+        // Methods to draw numbers.
+        uint64_t next() { // Returns 64 random bits.
+            uint64_t result = rotl(this->state[1] * 5, 7) * 9;
+            uint64_t t = this->state[1] << 17;
+            this->state[2] ^= this->state[0];
+            this->state[3] ^= this->state[1];
+            this->state[1] ^= this->state[2];
+            this->state[0] ^= this->state[3];
+            this->state[2] ^= t;
+            this->state[3] = rotl(this->state[3], 45);
+            return result;
+        }
+        int operator()() { return static_cast<int>(this->next() >> 33); } // Like rand(): 0 to 2147483647.
+        int below(int bound) { // Uniform in [0, bound) without the bias of a modulo.
+            return static_cast<int>(((this->next() >> 32) * static_cast<uint64_t>(bound)) >> 32);
+        }
+};
+
+#endif // End of include guard.
@@ -0,0 +1,110 @@
+/* A replay is the record of one finished headless game, packed into bytes so that
+millions of them fit in one file. A replay file is a 16-byte header followed by
+records back to back. Every record starts with a 22-byte head:
+
+    bytes  0-7   seed of the game's Random, little-endian
+    byte   8     CamdenType in the human's seat (the rival)
+    byte   9     CamdenType in the CPU's seat (Camden)
+    byte   10    flags: bit 0 set if the CPU fired first, bit 1 set if the CPU won
+    byte   11    number of shots in the game, both seats (at most 199)
+    bytes 12-16  rival's fleet, one byte per ShipType
+    bytes 17-21  Camden's fleet, one byte per ShipType
+
+and then one byte per shot, in the order fired. The seats take turns, so shot i
+was fired by the first seat when i is even. A shot byte is the bit index of the
+space (SpaceName - 1). A fleet byte is the bit index of the ship's first space
+(its top or left end) with bit 7 set when the ship runs down a column. */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "Enums.h"    // SpaceName, ShipType, PlayerType and CamdenType.
+#include "Bitboard.h" // Masks of the ships.
+#include "View.h"     // Copy-free view of the shots.
+
+#include <cstddef>
+    using std::size_t;
+
+#include <cstdint>
+    using std::uint8_t;
+    using std::uint64_t;
+
+// **Replay Struct**
+// Sizes and offsets of the file format.
+struct Replay {
+    inline static constexpr char MAGIC[4] = {'B', 'S', 'R', 'P'}; // First bytes of every replay file.
+    static constexpr uint8_t VERSION = 1;          // Format version, byte 4 of the file header.
+    static constexpr size_t FILE_HEADER = 16;      // Bytes before the first record.
+    static constexpr size_t RECORD_HEAD = 22;      // Bytes of a record before its shots.
+    static constexpr size_t MAX_RECORD = RECORD_HEAD + 199; // Longest possible record.
+    static constexpr size_t SEED = 0;              // Offsets within a record.
+    static constexpr size_t RIVAL_TYPE = 8;
+    static constexpr size_t CAMDEN_TYPE = 9;
+    static constexpr size_t FLAGS = 10;
+    static constexpr size_t NUM_SHOTS = 11;
+    static constexpr size_t RIVAL_FLEET = 12;
+    static constexpr size_t CAMDEN_FLEET = 17;
+    static constexpr uint8_t CPU_FIRST = 1;        // Flag bits.
+    static constexpr uint8_t CPU_WON = 2;
+    static constexpr uint8_t VERTICAL = 0x80;      // Fleet byte bit for a ship running down a column.
+};
+
+// **ReplayRecord Class**
+// Read-only view of one record inside a buffer such as a mapped file. Every field is
+// read straight from the bytes when asked for, so stepping over records costs nothing.
+class ReplayRecord {
+    private:
+        const uint8_t* bytes {nullptr}; // First byte of the record.
+
+        uint8_t fleet_byte(PlayerType player_type, ShipType ship_type) const {
+            return this->bytes[(player_type == MAN ? Replay::RIVAL_FLEET : Replay::CAMDEN_FLEET) + ship_type];
+        }
+
+    public:
+        // **Constructor**
+        constexpr ReplayRecord() {}
+        explicit constexpr ReplayRecord(const uint8_t* the_bytes) : bytes{the_bytes} {}
+
+        // **Game**
+        uint64_t getSeed() const { // Seed that replays the game through Simulation::playGame.
+            uint64_t seed = 0;
+            for(int i = 7; i >= 0; --i)
+                seed = (seed << 8) | this->bytes[Replay::SEED + i];
+            return seed;
+        }
+        CamdenType getRivalType() const { return static_cast<CamdenType>(this->bytes[Replay::RIVAL_TYPE]); }
+        CamdenType getCamdenType() const { return static_cast<CamdenType>(this->bytes[Replay::CAMDEN_TYPE]); }
+        PlayerType getFirstTurn() const { return this->bytes[Replay::FLAGS] & Replay::CPU_FIRST ? CPU : MAN; }
+        PlayerType getWinner() const { return this->bytes[Replay::FLAGS] & Replay::CPU_WON ? CPU : MAN; }
+
+        // **Fleets**
+        SpaceName getShipStart(PlayerType player_type, ShipType ship_type) const { // Top or left end of a ship.
+            return static_cast<SpaceName>((this->fleet_byte(player_type, ship_type) & ~Replay::VERTICAL) + 1);
+        }
+        bool shipIsVertical(PlayerType player_type, ShipType ship_type) const {
+            return this->fleet_byte(player_type, ship_type) & Replay::VERTICAL;
+        }
+        Bitboard getShipMask(PlayerType player_type, ShipType ship_type) const { // Every space of a ship.
+            int start = this->getShipStart(player_type, ship_type) - 1;
+            int step = this->shipIsVertical(player_type, ship_type) ? 10 : 1;
+            Bitboard mask;
+            for(int i = 0; i < Ships::lengthOf(ship_type); ++i)
+                mask.set(start + i * step);
+            return mask;
+        }
+
+        // **Shots**
+        int getNumShots() const { return this->bytes[Replay::NUM_SHOTS]; }
+        SpaceName getShot(int shot_index) const { return static_cast<SpaceName>(this->bytes[Replay::RECORD_HEAD + shot_index] + 1); }
+        PlayerType getShooter(int shot_index) const { // Seat that fired a shot.
+            PlayerType first = this->getFirstTurn();
+            return shot_index % 2 == 0 ? first : (first == MAN ? CPU : MAN);
+        }
+        View<uint8_t> viewShots() const { return View<uint8_t>(this->bytes + Replay::RECORD_HEAD, this->getNumShots()); } // Bit index of every shot.
+
+        // **Layout**
+        const uint8_t* data() const { return this->bytes; }
+        size_t size() const { return Replay::RECORD_HEAD + this->getNumShots(); } // Bytes of the record.
+};
+
+#endif
@@ -0,0 +1,213 @@
+#include "ReplayAnalytics.h"
+
+#include "Enums.h"          // Seats, ship types and ship lengths.
+#include "Replay.h"         // Records.
+#include "ReplayReader.h"   // Corpora.
+#include "ThreadPool.h"     // Workers.
+#include "PlacementPrior.h" // Priors.
+#include "Bitboard.h"       // Ship masks.
+#include "View.h"           // Shot bytes.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <string>
+    using std::string;
+
+#include <cstdint>
+    using std::uint8_t;
+
+#include <iomanip>
+    using std::setw;
+    using std::fixed;
+    using std::setprecision;
+
+#include <ostream>
+    using std::ostream;
+    using std::endl;
+
+// Per-worker counts, each on its own cache lines.
+struct alignas(64) AnalyticsWorker {
+    ReplayAnalytics counts;
+};
+
+// Names of the ships by ShipType, for reports.
+static const char* const SHIP_NAMES[] = {"Carrier", "Battleship", "Submarine", "Destroyer", "Cruiser"};
+
+// **Add a Record**
+// Lays both fleets out as a table from space to ship, then walks the shots once:
+// each hit takes one off its ship's count, and the shot that empties it is the
+// shooter's shots-to-sink for that ship.
+void ReplayAnalytics::add(const ReplayRecord& record) {
+    array<array<uint8_t, 100>, 2> ship_at {}; // ShipType + 1 on each space, 0 for water, by grid owner.
+    array<array<int, 5>, 2> hits_left;        // Hits still needed to sink each ship, by grid owner.
+    for(PlayerType owner : {CPU, MAN}) {
+        for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+            Bitboard rest = record.getShipMask(owner, static_cast<ShipType>(ship_type));
+            hits_left[owner][ship_type] = Ships::lengthOf(static_cast<ShipType>(ship_type));
+            while(rest.any()) {
+                int i = rest.popLowest();
+                ship_at[owner][i] = static_cast<uint8_t>(ship_type + 1);
+                ++this->fleetCells[owner][i];
+                ++this->shipCells[owner][ship_type][i];
+            }
+        }
+    }
+
+    PlayerType first = record.getFirstTurn();
+    PlayerType second = first == CPU ? MAN : CPU;
+    array<int, 2> fired {}; // Shots so far, by shooter.
+    View<uint8_t> shot_bytes = record.viewShots();
+    for(size_t i = 0; i < shot_bytes.size(); ++i) {
+        PlayerType shooter = i % 2 == 0 ? first : second;
+        PlayerType owner = shooter == CPU ? MAN : CPU;
+        int cell = shot_bytes[i];
+        ++fired[shooter];
+        if(cell > 99)
+            continue; // Not a space; a damaged record.
+        ++this->shotCells[owner][cell];
+        int ship = ship_at[owner][cell];
+        if(ship == 0)
+            continue;
+        ++this->hitCells[owner][cell];
+        if(--hits_left[owner][ship - 1] == 0)
+            ++this->shotsToSink[ship - 1][fired[shooter]];
+    }
+
+    ++this->games;
+    this->shots += static_cast<long>(shot_bytes.size());
+    ++this->wins[record.getWinner()];
+}
+
+// **Merge**
+void ReplayAnalytics::merge(const ReplayAnalytics& other) {
+    this->games += other.games;
+    this->shots += other.shots;
+    for(int owner = 0; owner < 2; ++owner) {
+        this->wins[owner] += other.wins[owner];
+        for(int i = 0; i < 100; ++i) {
+            this->fleetCells[owner][i] += other.fleetCells[owner][i];
+            this->shotCells[owner][i] += other.shotCells[owner][i];
+            this->hitCells[owner][i] += other.hitCells[owner][i];
+            for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type)
+                this->shipCells[owner][ship_type][i] += other.shipCells[owner][ship_type][i];
+        }
+    }
+    for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type)
+        for(size_t n = 0; n < this->shotsToSink[ship_type].size(); ++n)
+            this->shotsToSink[ship_type][n] += other.shotsToSink[ship_type][n];
+}
+
+// **Scan a Corpus**
+// Cuts the file into several runs per worker so that a worker that finishes early
+// picks up another, counts each run into the worker's own accumulator, and merges
+// the accumulators at the end.
+ReplayAnalytics ReplayAnalytics::scan(const ReplayReader& reader, ThreadPool& pool) {
+    size_t num_parts = pool.size() * 8;
+    vector<ReplayReader::Iterator> bounds = reader.split(num_parts);
+    vector<AnalyticsWorker> workers(pool.size());
+    pool.parallelFor(num_parts, 1, [&](size_t worker, size_t begin, size_t end) {
+        ReplayAnalytics& counts = workers[worker].counts;
+        for(size_t part = begin; part < end; ++part)
+            for(ReplayReader::Iterator it = bounds[part]; it != bounds[part + 1]; ++it)
+                counts.add(*it);
+    });
+    ReplayAnalytics total;
+    for(const AnalyticsWorker& worker : workers)
+        total.merge(worker.counts);
+    return total;
+}
+
+// **Ships Sunk**
+long ReplayAnalytics::sunk(ShipType ship_type) const {
+    long count = 0;
+    for(long games_at : this->shotsToSink[ship_type])
+        count += games_at;
+    return count;
+}
+
+// **Mean Shots to Sink**
+double ReplayAnalytics::meanShotsToSink(ShipType ship_type) const {
+    long count = 0;
+    long total = 0;
+    for(size_t n = 0; n < this->shotsToSink[ship_type].size(); ++n) {
+        count += this->shotsToSink[ship_type][n];
+        total += this->shotsToSink[ship_type][n] * static_cast<long>(n);
+    }
+    return count ? static_cast<double>(total) / static_cast<double>(count) : 0.0;
+}
+
+// **Shots-to-Sink Percentile**
+int ReplayAnalytics::shotsToSinkPercentile(ShipType ship_type, double percent) const {
+    long count = this->sunk(ship_type);
+    if(count == 0)
+        return 0;
+    long seen = 0;
+    for(size_t n = 0; n < this->shotsToSink[ship_type].size(); ++n) {
+        seen += this->shotsToSink[ship_type][n];
+        if(static_cast<double>(seen) * 100.0 >= percent * static_cast<double>(count))
+            return static_cast<int>(n);
+    }
+    return static_cast<int>(this->shotsToSink[ship_type].size()) - 1;
+}
+
+// **Fleet Prior**
+PlacementPrior ReplayAnalytics::prior(PlayerType owner) const {
+    return PlacementPrior(this->fleetCells[owner]);
+}
+
+// **Ship Prior**
+PlacementPrior ReplayAnalytics::prior(PlayerType owner, ShipType ship_type) const {
+    return PlacementPrior(this->shipCells[owner][ship_type]);
+}
+
+// **Print a Heatmap**
+void ReplayAnalytics::printHeatmap(ostream& out, string title, const array<long, 100>& cells, long total) {
+    out << title << endl;
+    out << "    ";
+    for(char column = 'A'; column <= 'J'; ++column)
+        out << setw(6) << column;
+    out << endl << fixed << setprecision(1);
+    for(int row_index = 0; row_index < 10; ++row_index) {
+        out << setw(4) << row_index + 1;
+        for(int column_index = 0; column_index < 10; ++column_index) {
+            long cell = cells[row_index * 10 + column_index];
+            out << setw(6) << (total ? 100.0 * static_cast<double>(cell) / static_cast<double>(total) : 0.0);
+        }
+        out << endl;
+    }
+    out.unsetf(std::ios::floatfield);
+    out << setprecision(6) << endl;
+}
+
+// **Print the Report**
+void ReplayAnalytics::printReport(ostream& out) const {
+    out << "Games:              " << this->games << endl;
+    out << "Shots:              " << this->shots << endl;
+    out << "Rival wins:         " << this->wins[MAN] << endl;
+    out << "Camden wins:        " << this->wins[CPU] << endl << endl;
+
+    printHeatmap(out, "Rival fleets (% of games a space held a ship)", this->fleetCells[MAN], this->games);
+    printHeatmap(out, "Camden's shots at rival fleets (% of games)", this->shotCells[MAN], this->games);
+    printHeatmap(out, "Camden's hits on rival fleets (% of games)", this->hitCells[MAN], this->games);
+    printHeatmap(out, "Camden fleets (% of games a space held a ship)", this->fleetCells[CPU], this->games);
+    printHeatmap(out, "Rival's shots at Camden fleets (% of games)", this->shotCells[CPU], this->games);
+    printHeatmap(out, "Rival's hits on Camden fleets (% of games)", this->hitCells[CPU], this->games);
+
+    out << "Shots to sink (the shooter's own shots when the ship went down)" << endl;
+    out << std::left << setw(12) << "ship" << std::right << setw(10) << "sunk" << setw(8) << "mean"
+        << setw(6) << "p10" << setw(6) << "p50" << setw(6) << "p90" << endl;
+    for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+        ShipType type = static_cast<ShipType>(ship_type);
+        out << std::left << setw(12) << SHIP_NAMES[ship_type] << std::right << setw(10) << this->sunk(type)
+            << fixed << setprecision(1) << setw(8) << this->meanShotsToSink(type)
+            << setw(6) << this->shotsToSinkPercentile(type, 10.0)
+            << setw(6) << this->shotsToSinkPercentile(type, 50.0)
+            << setw(6) << this->shotsToSinkPercentile(type, 90.0) << endl;
+        out.unsetf(std::ios::floatfield);
+        out << setprecision(6);
+    }
+}
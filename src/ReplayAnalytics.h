@@ -0,0 +1,49 @@
+#ifndef REPLAYANALYTICS_H
+#define REPLAYANALYTICS_H
+
+#include "Enums.h"          // Seats and ship types.
+#include "Replay.h"         // The records being counted.
+#include "ReplayReader.h"   // Corpora to scan.
+#include "ThreadPool.h"     // Workers for parallel scans.
+#include "PlacementPrior.h" // Priors learned from the fleets.
+
+#include <array>
+    using std::array;
+
+#include <string>
+    using std::string;
+
+#include <ostream>
+    using std::ostream;
+
+// **ReplayAnalytics Struct**
+// Running counts over a corpus of replays. Grids are named by the seat that owns
+// them (indexed by PlayerType: CPU is Camden's seat, MAN the rival's), so
+// fleetCells[MAN] counts where rival fleets lay and hitCells[MAN] where Camden hit them.
+struct ReplayAnalytics {
+    long games {0};                                     // Records counted.
+    long shots {0};                                     // Shots over every record, both seats.
+    array<long, 2> wins {};                             // Games won, by seat.
+    array<array<long, 100>, 2> fleetCells {};           // Games a space held a ship, by grid owner.
+    array<array<array<long, 100>, 5>, 2> shipCells {};  // Games a space held each ShipType, by grid owner.
+    array<array<long, 100>, 2> shotCells {};            // Shots landing on each space, by grid owner.
+    array<array<long, 100>, 2> hitCells {};             // Hits on each space, by grid owner.
+    array<array<long, 101>, 5> shotsToSink {};          // By ShipType: games in which the shooter sank it with its n-th shot.
+
+    void add(const ReplayRecord& record);               // Counts one record.
+    void merge(const ReplayAnalytics& other);           // Adds another accumulator's counts.
+    static ReplayAnalytics scan(const ReplayReader& reader, ThreadPool& pool); // Counts a whole corpus on every worker of the pool.
+
+    // **Results**
+    long sunk(ShipType ship_type) const;                // Games in which the ship was sunk.
+    double meanShotsToSink(ShipType ship_type) const;   // Mean of the shooter's shot count at the sinking.
+    int shotsToSinkPercentile(ShipType ship_type, double percent) const; // Smallest n with at least percent of sinkings by shot n.
+    PlacementPrior prior(PlayerType owner) const;       // Where the seat's fleets lay, as a prior for hunting it.
+    PlacementPrior prior(PlayerType owner, ShipType ship_type) const; // Where one of the seat's ships lay.
+
+    // **Reporting**
+    void printReport(ostream& out) const;               // Totals, heatmaps and the shots-to-sink table.
+    static void printHeatmap(ostream& out, string title, const array<long, 100>& cells, long total); // Percent of total per space.
+};
+
+#endif
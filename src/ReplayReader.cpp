@@ -0,0 +1,93 @@
+#include "ReplayReader.h"
+
+#include "Replay.h"  // File format.
+
+#include <string>
+    using std::string;
+
+#include <vector>
+    using std::vector;
+
+#include <stdexcept>
+    using std::runtime_error;
+
+#include <fcntl.h>     // For open.
+#include <sys/mman.h>  // For mmap, madvise and munmap.
+#include <sys/stat.h>  // For fstat.
+#include <unistd.h>    // For close.
+
+// **Constructor**
+// Maps the whole file and checks its header.
+ReplayReader::ReplayReader(string file_path) {
+    this->descriptor = open(file_path.c_str(), O_RDONLY);
+    if(this->descriptor < 0)
+        throw runtime_error("Cannot open replay file " + file_path);
+    struct stat info;
+    if(fstat(this->descriptor, &info) != 0 || info.st_size < static_cast<off_t>(Replay::FILE_HEADER)) {
+        close(this->descriptor);
+        throw runtime_error("Not a replay file: " + file_path);
+    }
+    this->length = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, this->descriptor, 0);
+    if(mapping == MAP_FAILED) {
+        close(this->descriptor);
+        throw runtime_error("Cannot map replay file " + file_path);
+    }
+    madvise(mapping, this->length, MADV_SEQUENTIAL); // Records are read front to back.
+    this->data = static_cast<const uint8_t*>(mapping);
+    if(string(reinterpret_cast<const char*>(this->data), 4) != string(Replay::MAGIC, 4) || this->data[4] != Replay::VERSION) {
+        munmap(mapping, this->length);
+        close(this->descriptor);
+        throw runtime_error("Not a replay file: " + file_path);
+    }
+}
+
+// **Destructor**
+ReplayReader::~ReplayReader() {
+    munmap(const_cast<uint8_t*>(this->data), this->length);
+    close(this->descriptor);
+}
+
+// **First Record**
+ReplayReader::Iterator ReplayReader::begin() const {
+    return Iterator(this->data + Replay::FILE_HEADER, this->data + this->length);
+}
+
+// **Past the Last Record**
+ReplayReader::Iterator ReplayReader::end() const {
+    return Iterator(this->data + this->length, this->data + this->length);
+}
+
+// **Count the Records**
+long ReplayReader::countRecords() const {
+    long count = 0;
+    for(Iterator it = this->begin(); it != this->end(); ++it)
+        ++count;
+    return count;
+}
+
+// **Split for Parallel Scans**
+// Records vary in length, so the boundaries are found with one walk that steps
+// from head to head; only the shot count of each record is read.
+vector<ReplayReader::Iterator> ReplayReader::split(size_t num_parts) const {
+    if(num_parts == 0)
+        num_parts = 1;
+    vector<Iterator> bounds;
+    bounds.reserve(num_parts + 1);
+    Iterator it = this->begin();
+    bounds.push_back(it);
+    size_t records_bytes = this->length - Replay::FILE_HEADER;
+    for(size_t part = 1; part < num_parts; ++part) {
+        const uint8_t* target = this->data + Replay::FILE_HEADER + records_bytes / num_parts * part;
+        while(it != this->end() && it.position() < target)
+            ++it;
+        bounds.push_back(it);
+    }
+    bounds.push_back(this->end());
+    return bounds;
+}
+
+// **File Size**
+size_t ReplayReader::getSize() const {
+    return this->length;
+}
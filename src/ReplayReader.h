@@ -0,0 +1,72 @@
+#ifndef REPLAYREADER_H
+#define REPLAYREADER_H
+
+#include "Replay.h"  // File format and the record view.
+
+#include <string>
+    using std::string;
+
+#include <cstddef>
+    using std::size_t;
+
+#include <cstdint>
+    using std::uint8_t;
+
+#include <vector>
+    using std::vector;
+
+// **ReplayReader Class**
+// Maps a replay file into memory read-only and walks its records in place: each
+// step reads one shot count and moves a pointer, so nothing is parsed or copied
+// and the OS pages the file in as the walk reaches it. A partly written last
+// record (say from an interrupted run) ends the walk.
+class ReplayReader {
+    private:
+        const uint8_t* data {nullptr}; // Start of the mapping.
+        size_t length {0};             // Bytes mapped.
+        int descriptor {-1};           // Open file behind the mapping.
+
+    public:
+        // **Iterator**
+        // Forward iterator over the records; dereferencing gives a ReplayRecord.
+        class Iterator {
+            private:
+                const uint8_t* at;     // Current record, or the end.
+                const uint8_t* end;    // End of the mapping.
+
+                void check() {         // Moves to the end if the current record does not fit.
+                    if(this->end - this->at < static_cast<long>(Replay::RECORD_HEAD)
+                       || this->end - this->at < static_cast<long>(ReplayRecord(this->at).size()))
+                        this->at = this->end;
+                }
+
+            public:
+                Iterator(const uint8_t* the_at, const uint8_t* the_end) : at{the_at}, end{the_end} { this->check(); }
+                ReplayRecord operator*() const { return ReplayRecord(this->at); }
+                Iterator& operator++() {
+                    this->at += ReplayRecord(this->at).size();
+                    this->check();
+                    return *this;
+                }
+                bool operator==(const Iterator& other) const { return this->at == other.at; }
+                bool operator!=(const Iterator& other) const { return this->at != other.at; }
+                const uint8_t* position() const { return this->at; } // Current record's first byte.
+        };
+
+        // **Constructor and Destructor**
+        explicit ReplayReader(string file_path); // Throws runtime_error if the file cannot be mapped or is not a replay file.
+        ~ReplayReader();                         // Unmaps and closes the file.
+        ReplayReader(const ReplayReader&) = delete;
+        ReplayReader& operator=(const ReplayReader&) = delete;
+
+        // **Records**
+        Iterator begin() const;  // First record.
+        Iterator end() const;    // Past the last whole record.
+        long countRecords() const; // Walks the file once to count its records.
+        // Cuts the records into num_parts runs of about equal bytes for parallel scans:
+        // part i runs from element i to element i + 1 of the num_parts + 1 results.
+        vector<Iterator> split(size_t num_parts) const;
+        size_t getSize() const;  // Bytes in the file, header included.
+};
+
+#endif
@@ -0,0 +1,123 @@
+#include "ReplayWriter.h"
+
+#include "Replay.h"   // File format.
+#include "Enums.h"    // Seats and ship types.
+#include "Game.h"     // Finished games.
+#include "Player.h"   // Fleets and shot logs.
+#include "Camden.h"   // Strategies of the seats.
+#include "Bitboard.h" // Ship masks.
+
+#include <string>
+    using std::string;
+
+#include <fstream>
+    using std::ifstream;
+    using std::ios;
+
+#include <mutex>
+    using std::lock_guard;
+
+#include <stdexcept>
+    using std::runtime_error;
+
+// Encodes one ship of a placed fleet as its first bit index, plus the vertical flag.
+static uint8_t fleet_byte(Bitboard ship_mask) {
+    int start = ship_mask.lowest();
+    bool vertical = ship_mask.test(start + 10);
+    return static_cast<uint8_t>(start) | (vertical ? Replay::VERTICAL : 0);
+}
+
+// **Constructor**
+// Opens the file for appending, writing the header if the file is new and checking
+// it otherwise.
+ReplayWriter::ReplayWriter(string file_path, size_t buffer_bytes) : path{file_path}, bufferLimit{buffer_bytes} {
+    ifstream existing(file_path, ios::binary | ios::ate);
+    bool is_new = !existing || existing.tellg() == 0;
+    if(!is_new) {
+        char header[Replay::FILE_HEADER] = {};
+        existing.seekg(0);
+        existing.read(header, Replay::FILE_HEADER);
+        if(!existing || string(header, 4) != string(Replay::MAGIC, 4) || header[4] != Replay::VERSION)
+            throw runtime_error("Not a replay file: " + file_path);
+    }
+    existing.close();
+    this->file.open(file_path, ios::binary | ios::app);
+    if(!this->file)
+        throw runtime_error("Cannot write replay file " + file_path);
+    this->buffer.reserve(this->bufferLimit + Replay::MAX_RECORD);
+    if(is_new) {
+        uint8_t header[Replay::FILE_HEADER] = {};
+        for(size_t i = 0; i < 4; ++i)
+            header[i] = static_cast<uint8_t>(Replay::MAGIC[i]);
+        header[4] = Replay::VERSION;
+        this->buffer.insert(this->buffer.end(), header, header + Replay::FILE_HEADER);
+    }
+}
+
+// **Destructor**
+// Writes out buffered records; a failure here cannot be reported any more.
+ReplayWriter::~ReplayWriter() {
+    try {
+        this->flush();
+    } catch(...) {}
+}
+
+// **Encode a Game**
+// Lays a finished game out as one record; game.winner() throws if it is not over.
+size_t ReplayWriter::encode(const Game& game, uint64_t seed, uint8_t* out) {
+    PlayerType winner = game.winner();
+    Player* human = game.getHuman();
+    Player* cpu = game.getCpu();
+    for(size_t i = 0; i < 8; ++i)
+        out[Replay::SEED + i] = static_cast<uint8_t>(seed >> (8 * i));
+    out[Replay::RIVAL_TYPE] = static_cast<uint8_t>(game.getRival() != nullptr ? game.getRival()->getType() : RANDOM);
+    out[Replay::CAMDEN_TYPE] = static_cast<uint8_t>(game.getCamden()->getType());
+    out[Replay::FLAGS] = (game.getFirstTurn() == CPU ? Replay::CPU_FIRST : 0) | (winner == CPU ? Replay::CPU_WON : 0);
+    for(int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type) {
+        out[Replay::RIVAL_FLEET + ship_type] = fleet_byte(human->getGrid()->getShipMask(static_cast<ShipType>(ship_type)));
+        out[Replay::CAMDEN_FLEET + ship_type] = fleet_byte(cpu->getGrid()->getShipMask(static_cast<ShipType>(ship_type)));
+    }
+    // The seats alternate, so the first seat's log and the second's interleave.
+    View<uint8_t> first = (game.getFirstTurn() == CPU ? cpu : human)->viewShotLog();
+    View<uint8_t> second = (game.getFirstTurn() == CPU ? human : cpu)->viewShotLog();
+    size_t num_shots = first.size() + second.size();
+    uint8_t* shots = out + Replay::RECORD_HEAD;
+    for(size_t i = 0; i < num_shots; ++i)
+        shots[i] = i % 2 == 0 ? first[i / 2] : second[i / 2];
+    out[Replay::NUM_SHOTS] = static_cast<uint8_t>(num_shots);
+    return Replay::RECORD_HEAD + num_shots;
+}
+
+// **Append a Game**
+// Encodes outside the lock, so threads only queue up for the copy into the buffer.
+void ReplayWriter::append(const Game& game, uint64_t seed) {
+    uint8_t record[Replay::MAX_RECORD];
+    size_t size = encode(game, seed, record);
+    lock_guard<mutex> guard(this->lock);
+    this->buffer.insert(this->buffer.end(), record, record + size);
+    ++this->numRecords;
+    if(this->buffer.size() >= this->bufferLimit)
+        this->write_buffer();
+}
+
+// **Flush**
+void ReplayWriter::flush() {
+    lock_guard<mutex> guard(this->lock);
+    this->write_buffer();
+    this->file.flush();
+}
+
+// **Record Count**
+long ReplayWriter::getNumRecords() const {
+    return this->numRecords;
+}
+
+// **Write the Buffer**
+void ReplayWriter::write_buffer() {
+    if(this->buffer.empty())
+        return;
+    this->file.write(reinterpret_cast<const char*>(this->buffer.data()), static_cast<std::streamsize>(this->buffer.size()));
+    if(!this->file)
+        throw runtime_error("Cannot write replay file " + this->path);
+    this->buffer.clear();
+}
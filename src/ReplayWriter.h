@@ -0,0 +1,59 @@
+#ifndef REPLAYWRITER_H
+#define REPLAYWRITER_H
+
+#include "Replay.h"  // File format.
+#include "Game.h"    // Finished games to record.
+
+#include <string>
+    using std::string;
+
+#include <vector>
+    using std::vector;
+
+#include <fstream>
+    using std::ofstream;
+
+#include <mutex>
+    using std::mutex;
+
+#include <cstddef>
+    using std::size_t;
+
+#include <cstdint>
+    using std::uint8_t;
+    using std::uint64_t;
+
+// **ReplayWriter Class**
+// Appends finished games to a replay file (see Replay.h). Records collect in a
+// buffer that is written out whenever it fills, by flush, and by the destructor.
+// A new file gets the file header; an existing one is checked and added to.
+// append may be called from several threads; each record is written whole, in
+// the order the calls finish.
+class ReplayWriter {
+    private:
+        ofstream file;              // Opened for appending.
+        string path;                // For error messages.
+        vector<uint8_t> buffer;     // Records not yet written.
+        size_t bufferLimit;         // Buffer size that triggers a write.
+        long numRecords {0};        // Records appended through this writer.
+        mutex lock;                 // Guards the buffer and the file.
+
+        void write_buffer();        // Writes the buffer out and empties it; caller holds the lock.
+
+    public:
+        // **Constructor and Destructor**
+        explicit ReplayWriter(string file_path, size_t buffer_bytes = 1 << 16); // Throws runtime_error if the file cannot be used.
+        ~ReplayWriter();                          // Writes out what is left.
+        ReplayWriter(const ReplayWriter&) = delete;
+        ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+        // **Recording**
+        void append(const Game& game, uint64_t seed); // Records a finished game played from seed.
+        void flush();                                 // Writes buffered records to the file.
+        long getNumRecords() const;                   // Records appended so far.
+
+        // **Encoding**
+        static size_t encode(const Game& game, uint64_t seed, uint8_t* out); // Writes a record of at most Replay::MAX_RECORD bytes; returns its size.
+};
+
+#endif
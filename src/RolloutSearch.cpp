@@ -0,0 +1,256 @@
+#include "RolloutSearch.h"
+
+#include "Enums.h"          // Ship lengths.
+#include "Bitboard.h"       // Masks.
+#include "Heatmap.h"        // Placements, weights and the playout policy.
+#include "FleetGenerator.h" // The draw the fleets are weighed against.
+#include "Placements.h"     // Placement masks.
+#include "Random.h"         // Per-round engines.
+#include "ThreadPool.h"     // Workers.
+#include "View.h"           // Afloat ship types.
+
+#include <array>
+    using std::array;
+
+#include <vector>
+    using std::vector;
+
+#include <algorithm>
+    using std::sort;
+    using std::min;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+    using std::chrono::duration;
+
+// Most spaces a search compares.
+static constexpr int MAX_CANDIDATES = 100;
+
+// Attempts at a fitting fleet before a round is given up.
+static constexpr int SAMPLE_ATTEMPTS = 32;
+
+// Paired differences a candidate must beat the heaviest one by, in standard errors,
+// before the search overrules the heatmap.
+static constexpr double MIN_Z_SCORE = 2.0;
+
+// What one round found: its fleet's weight and each candidate's shots to finish.
+struct RolloutRound {
+    double weight {0.0};                 // 0 if no fleet fitted.
+    array<int, MAX_CANDIDATES> shots;
+    Heatmap scratch;                     // The playouts' own copy of the heatmap.
+};
+
+// Weighted sums over the rounds, folded in round order so they never depend on
+// which worker played which round.
+struct RolloutTotals {
+    double weight {0.0};                          // Fleet weights.
+    double squaredWeight {0.0};                   // Squared fleet weights, for the effective sample size.
+    array<double, MAX_CANDIDATES> shots {};       // Shots to finish, by candidate.
+    array<double, MAX_CANDIDATES> squaredGaps {}; // Squared shots over the heaviest candidate's, by candidate.
+
+    void fold(const RolloutRound& round, int num_candidates) {
+        if (round.weight == 0.0)
+            return;
+        this->weight += round.weight;
+        this->squaredWeight += round.weight * round.weight;
+        for (int c = 0; c < num_candidates; ++c) {
+            double gap = round.shots[c] - round.shots[0];
+            this->shots[c] += round.weight * round.shots[c];
+            this->squaredGaps[c] += round.weight * gap * gap;
+        }
+    }
+};
+
+// **Sample a Fleet**
+// Covers the unresolved hits first, lowest first, each with a random legal placement
+// of any unused ship through it, then lays the other ships at random. Placements come
+// from the heatmap, which already rules out misses, sunk ships and their halos. A ship
+// lying wholly on hits would have been announced sunk, so none is placed there.
+// Drawing this way favours fleets with few ways to fit, so each fleet is weighed by
+// how likely FleetGenerator's sequential draw is to lay the whole fleet, sunk ships
+// included, over how likely this draw was to pick it.
+double RolloutSearch::sampleFleet(const Heatmap& heatmap, const Observation& observation, Random& rand_func, array<Bitboard, 5>& ships) {
+    Bitboard unresolved = observation.hits & ~observation.sunk;
+    for (int attempt = 0; attempt < SAMPLE_ATTEMPTS; ++attempt) {
+        Bitboard taken;       // Sampled ships and their halos.
+        Bitboard uncovered = unresolved;
+        unsigned unused = (1u << observation.numAfloat) - 1;
+        double weight = 1.0;
+        bool fits = true;
+        while (fits && uncovered.any()) {
+            int hit = uncovered.lowest();
+            const Placement* chosen = nullptr;
+            int chosen_ship = -1;
+            int seen = 0;
+            for (int k = 0; k < observation.numAfloat; ++k) {
+                if (!(unused >> k & 1))
+                    continue;
+                for (const Placement& placement : heatmap.viewPlacements(Ships::lengthOf(observation.afloat[k])))
+                    if (placement.mask.test(hit) && !placement.mask.intersects(taken) && (placement.mask & ~unresolved).any() && rand_func.below(++seen) == 0) {
+                        chosen = &placement;
+                        chosen_ship = k;
+                    }
+            }
+            if (chosen == nullptr) {
+                fits = false;
+                break;
+            }
+            ships[chosen_ship] = chosen->mask;
+            taken |= chosen->mask.spread();
+            uncovered &= ~chosen->mask;
+            unused &= ~(1u << chosen_ship);
+            weight *= seen;
+        }
+        for (int k = 0; fits && k < observation.numAfloat; ++k) {
+            if (!(unused >> k & 1))
+                continue;
+            const Placement* chosen = nullptr;
+            int seen = 0;
+            for (const Placement& placement : heatmap.viewPlacements(Ships::lengthOf(observation.afloat[k])))
+                if (!placement.mask.intersects(taken) && rand_func.below(++seen) == 0)
+                    chosen = &placement;
+            if (chosen == nullptr) {
+                fits = false;
+                break;
+            }
+            ships[k] = chosen->mask;
+            taken |= chosen->mask.spread();
+            weight *= seen;
+        }
+        if (!fits)
+            continue;
+
+        array<Bitboard, 5> by_type = observation.sunkShips;
+        for (int k = 0; k < observation.numAfloat; ++k)
+            by_type[observation.afloat[k]] = ships[k];
+        return weight * FleetGenerator::sequentialChance(by_type);
+    }
+    return 0.0;
+}
+
+// **Play Out**
+// Plays HARD's own policy against the sampled ships: the heatmap is narrowed by every
+// shot and the densest space is fired at next, so a candidate is judged by the game
+// Camden would go on to play after it.
+int RolloutSearch::playout(const Observation& observation, const array<Bitboard, 5>& ships, SpaceName first_shot, Heatmap& heatmap, Random& rand_func) {
+    Bitboard shots = observation.targeted;
+    Bitboard hits = observation.hits;
+    Bitboard sunk = observation.sunk;
+    Bitboard fleet;
+    for (int k = 0; k < observation.numAfloat; ++k)
+        fleet |= ships[k];
+    array<ShipType, 5> afloat = observation.afloat;
+    array<Bitboard, 5> afloat_ships = ships;
+    int num_afloat = observation.numAfloat;
+    int num_shots = 0;
+    SpaceName space = first_shot;
+    for (;;) {
+        int shot = static_cast<int>(space) - 1;
+        ++num_shots;
+        shots.set(shot);
+        if (fleet.test(shot)) {
+            hits.set(shot);
+            for (int k = 0; k < num_afloat; ++k) {
+                if (afloat_ships[k].test(shot)) {
+                    if ((afloat_ships[k] & ~shots).none()) {
+                        sunk |= afloat_ships[k];
+                        --num_afloat;
+                        afloat[k] = afloat[num_afloat];
+                        afloat_ships[k] = afloat_ships[num_afloat];
+                    }
+                    break;
+                }
+            }
+            if (num_afloat == 0)
+                return num_shots;
+        }
+        heatmap.observe(hits, (shots & ~hits) | sunk.spread());
+        space = heatmap.bestSpace(View<ShipType>(afloat.data(), static_cast<size_t>(num_afloat)), hits & ~sunk, shots, rand_func);
+        if (space == NO_SPACE)
+            space = static_cast<SpaceName>((~shots).lowest() + 1); // Cannot happen with a consistent fleet; keeps the loop finite.
+    }
+}
+
+// **Best Move**
+// Candidates are the heaviest untargeted spaces by the heatmap, heaviest first. Round r
+// samples its fleet from Random::mix(seed, r), so the rounds can run in any order on
+// any worker; they are played in batches, one per pool round trip, until the budget
+// is spent.
+SpaceName RolloutSearch::bestMove(const Heatmap& heatmap, const Observation& observation, const SearchBudget& budget, Random& rand_func) {
+    Bitboard unresolved = observation.hits & ~observation.sunk;
+    array<long, 100> weights;
+    heatmap.weigh(View<ShipType>(observation.afloat.data(), static_cast<size_t>(observation.numAfloat)), unresolved, observation.targeted, weights);
+    array<int, 100> candidates;
+    int num_candidates = 0;
+    Bitboard open = ~observation.targeted;
+    while (open.any()) {
+        int i = open.popLowest();
+        if (weights[i] > 0)
+            candidates[num_candidates++] = i;
+    }
+    if (num_candidates == 0)
+        return NO_SPACE;
+    sort(candidates.begin(), candidates.begin() + num_candidates, [&](int a, int b) {
+        return weights[a] != weights[b] ? weights[a] > weights[b] : a < b;
+    });
+    num_candidates = min(num_candidates, budget.candidates > 0 ? min(budget.candidates, MAX_CANDIDATES) : 1);
+    if (num_candidates == 1)
+        return static_cast<SpaceName>(candidates[0] + 1);
+
+    long max_rounds = budget.rollouts > 0 ? (budget.rollouts + num_candidates - 1) / num_candidates : 0;
+    if (max_rounds == 0 && budget.seconds <= 0.0)
+        max_rounds = 1;
+    steady_clock::time_point start = steady_clock::now();
+    auto out_of_time = [&]() {
+        return budget.seconds > 0.0 && duration<double>(steady_clock::now() - start).count() >= budget.seconds;
+    };
+    uint64_t seed = rand_func.next();
+    auto play_round = [&](long round_index, RolloutRound& round) {
+        Random round_rand(Random::mix(seed, static_cast<uint64_t>(round_index)));
+        array<Bitboard, 5> ships;
+        round.weight = sampleFleet(heatmap, observation, round_rand, ships);
+        if (round.weight == 0.0)
+            return;
+        uint64_t policy_seed = round_rand.next();
+        for (int c = 0; c < num_candidates; ++c) {
+            round.scratch = heatmap; // Reuses the scratch lists' storage.
+            Random policy_rand(policy_seed); // The same tie breaks for every candidate.
+            round.shots[c] = playout(observation, ships, static_cast<SpaceName>(candidates[c] + 1), round.scratch, policy_rand);
+        }
+    };
+
+    RolloutTotals totals;
+    vector<RolloutRound> batch_rounds(budget.pool != nullptr ? budget.pool->size() * 4 : 1);
+    long rounds = 0;
+    do {
+        long batch = static_cast<long>(batch_rounds.size());
+        if (max_rounds > 0)
+            batch = min(batch, max_rounds - rounds);
+        if (budget.pool == nullptr) {
+            play_round(rounds, batch_rounds[0]);
+        } else {
+            long first = rounds;
+            budget.pool->parallelFor(static_cast<size_t>(batch), 1, [&](size_t, size_t begin, size_t end) {
+                for (size_t r = begin; r < end; ++r)
+                    play_round(first + static_cast<long>(r), batch_rounds[r]);
+            });
+        }
+        for (long r = 0; r < batch; ++r)
+            totals.fold(batch_rounds[r], num_candidates);
+        rounds += batch;
+    } while ((max_rounds == 0 || rounds < max_rounds) && !out_of_time());
+
+    // A candidate replaces the heaviest only if its mean gap is clearly below zero,
+    // so a small or noisy search falls back on the heatmap's choice.
+    if (totals.weight == 0.0)
+        return static_cast<SpaceName>(candidates[0] + 1); // No fleet fitted; trust the heatmap.
+    double effective_rounds = totals.weight * totals.weight / totals.squaredWeight;
+    int best = 0;
+    for (int c = 1; c < num_candidates; ++c) {
+        double mean_gap = (totals.shots[c] - totals.shots[0]) / totals.weight;
+        double variance = totals.squaredGaps[c] / totals.weight - mean_gap * mean_gap;
+        if (mean_gap < 0.0 && mean_gap * mean_gap * effective_rounds > MIN_Z_SCORE * MIN_Z_SCORE * variance && totals.shots[c] < totals.shots[best])
+            best = c;
+    }
+    return static_cast<SpaceName>(candidates[best] + 1);
+}
@@ -0,0 +1,63 @@
+#ifndef ROLLOUTSEARCH_H
+#define ROLLOUTSEARCH_H
+
+#include "Enums.h"      // SpaceName and ShipType.
+#include "Bitboard.h"   // Observations and sampled ships.
+#include "Heatmap.h"    // Legal placements and candidate weights.
+#include "Random.h"     // Sampling and rollout policy.
+#include "ThreadPool.h" // Optional workers for one move.
+#include "View.h"       // Afloat ship types.
+
+#include <array>
+    using std::array;
+
+#include <cstdint>
+    using std::uint64_t;
+
+// **SearchBudget Struct**
+// How much work one rollout move may do. The search stops at whichever limit comes
+// first; a limit of 0 is no limit, and at least one round is always played. With a
+// rollout limit alone the chosen move depends only on the seed, not on the threads.
+struct SearchBudget {
+    long rollouts {512};          // Playouts per move, over every candidate.
+    double seconds {0.0};         // Wall-clock time per move.
+    int candidates {4};           // Spaces compared, the heaviest by the heatmap.
+    ThreadPool* pool {nullptr};   // Workers that share the rollouts, or nullptr for the calling thread.
+};
+
+// **RolloutSearch Class**
+// Monte Carlo move choice for the ROLLOUT strategy. Each round samples one fleet of
+// the ships still afloat that fits every observation, then plays the rest of the
+// game against it once per candidate: the candidate first, then HARD's heatmap policy.
+// Every candidate of a round sees the same fleet and the same tie breaks, so their
+// shot counts differ only by the first shot. Rounds go on until the budget runs out,
+// so the answer is anytime. The heaviest candidate by the heatmap is kept unless
+// another needs clearly fewer shots to finish, so a small budget plays like HARD.
+class RolloutSearch {
+    public:
+        // **Observations**
+        // What the shooter knows about the foe's grid.
+        struct Observation {
+            Bitboard hits;                  // Hits, on sunk ships or not.
+            Bitboard sunk;                  // Spaces of the sunk ships.
+            array<Bitboard, 5> sunkShips {}; // Spaces of each sunk ship by ShipType, empty while it is afloat.
+            Bitboard targeted;              // Every space fired at.
+            array<ShipType, 5> afloat {};   // Ships not yet sunk; the first numAfloat are used.
+            int numAfloat {0};
+        };
+
+        // **Searching**
+        // Best space by the budget, or NO_SPACE if no fleet fits the observations.
+        static SpaceName bestMove(const Heatmap& heatmap, const Observation& observation, const SearchBudget& budget, Random& rand_func);
+
+        // **Pieces**
+        // Draws a fleet of the afloat ships that covers every unresolved hit, avoids
+        // every blocked space and keeps ships apart. Returns the fleet's importance
+        // weight against FleetGenerator's sequential draw, or 0 if the attempts ran out.
+        static double sampleFleet(const Heatmap& heatmap, const Observation& observation, Random& rand_func, array<Bitboard, 5>& ships);
+        // Shots HARD's policy needs to sink the sampled ships, starting with first_shot;
+        // the heatmap must hold the observations and is narrowed as the playout goes.
+        static int playout(const Observation& observation, const array<Bitboard, 5>& ships, SpaceName first_shot, Heatmap& heatmap, Random& rand_func);
+};
+
+#endif
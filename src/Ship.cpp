@@ -9,6 +9,9 @@
 #include <vector> // Include for using vector class.
     using std::vector; // Use vector from the standard namespace.
 
+#include <stdexcept> // Include for reporting too many studs.
+    using std::length_error; // Use length_error from the standard namespace.
+
 // Method: Sets the name of the ship based on its type.
 void Ship::set_ship_name(ShipType ship_type) {
     switch (ship_type) {
@@ -52,15 +55,31 @@ Ship::Ship(ShipType ship_type, PlayerType of_player) : shipType{ship_type}, ofPl
 Ship::Ship(ShipType ship_type, Grid* on_grid) : shipType{ship_type}, onGrid{on_grid} {
     this->set_ship_name(ship_type); // Set the name of the ship.
     this->ofPlayer = on_grid->getOfPlayer(); // Set the player type based on the grid.
+    this->arena = on_grid->getArena(); // Studs live where the grid's objects live.
 }
 
 // Destructor: Cleans up resources used by the Ship.
 Ship::~Ship() {
     this->onGrid = nullptr; // Set grid pointer to nullptr.
-    for(Stud* &intact_stud : this->intactStuds)
-        intact_stud = nullptr; // Set intact studs to nullptr.
-    for(Stud* &destroyed_stud : this->destroyedStuds)
-        destroyed_stud = nullptr; // Set destroyed studs to nullptr.
+    this->shipStuds.fill(nullptr); // The derived class frees the studs themselves.
+}
+
+// Method: Finds a stud's slot from its name, since each ship's stud names are consecutive.
+int Ship::stud_index(const Stud* stud) const {
+    if(stud == nullptr || this->numStuds == 0)
+        return -1;
+    int index = static_cast<int>(stud->getStudName()) - static_cast<int>(this->shipStuds[0]->getStudName());
+    if(index < 0 || index >= this->numStuds || this->shipStuds[index] != stud)
+        return -1; // Not one of this ship's studs.
+    return index;
+}
+
+// Method: Registers a newly built stud as intact.
+void Ship::add_stud(Stud* stud) {
+    if(this->numStuds == static_cast<int>(this->shipStuds.size()))
+        throw length_error("A ship has at most five studs.");
+    this->shipStuds[this->numStuds++] = stud;
+    ++this->hitsLeft;
 }
 
 // Getter: Returns the PlayerType associated with the ship.
@@ -75,12 +94,30 @@ Grid* Ship::getOnGrid() const {
 
 // Getter: Returns a vector of intact studs on the ship.
 vector<Stud*> Ship::getIntactSutds() const {
-    return this->intactStuds;
+    vector<Stud*> intact_studs;
+    for(int i = 0; i < this->numStuds; ++i)
+        if(!(this->hitStuds & (1u << i)))
+            intact_studs.push_back(this->shipStuds[i]);
+    return intact_studs;
 }
 
 // Getter: Returns a vector of destroyed studs on the ship.
 vector<Stud*> Ship::getDestroyedStuds() const {
-    return this->destroyedStuds;
+    vector<Stud*> destroyed_studs;
+    for(int i = 0; i < this->numStuds; ++i)
+        if(this->hitStuds & (1u << i))
+            destroyed_studs.push_back(this->shipStuds[i]);
+    return destroyed_studs;
+}
+
+// Getter: Returns a view of all the ship's studs, intact or not.
+View<Stud*> Ship::viewStuds() const {
+    return View<Stud*>(this->shipStuds.data(), static_cast<size_t>(this->numStuds));
+}
+
+// Getter: Returns the number of hits still needed to sink the ship.
+int Ship::getHitsLeft() const {
+    return this->hitsLeft;
 }
 
 // Getter: Returns the type of the ship.
@@ -139,30 +176,42 @@ void Ship::setIsReady(bool is_ready) {
     this->isReady = is_ready;
 }
 
+// Method: Places the ship from a space string by converting it to a SpaceName.
+bool Ship::placeOnGrid(string start_space, char direction, bool print_out) const {
+    return this->placeOnGrid(Spaces::nameFromString(start_space), direction, print_out);
+}
+
 // Method: Checks if a specific stud on the ship is intact.
 bool Ship::studIsIntact(Stud* stud) const {
-    for(Stud* the_stud : this->intactStuds)
-        if (the_stud == stud)
-            return true;
-    return false;
+    int index = this->stud_index(stud);
+    return index >= 0 && !(this->hitStuds & (1u << index));
 }
 
 // Method: Checks if the ship has been sunk (all studs destroyed).
 bool Ship::wasSunk() const {
-    return this->isReady && !this->intactStuds.size(); // Return true if no intact studs remain.
+    return this->isReady && this->hitsLeft == 0; // Return true if no intact studs remain.
 }
 
 // Method: Marks a stud as destroyed and updates the ship's status.
+// One bit and one counter change per hit, whatever the ship's length.
 void Ship::destroyStud(Stud* stud) {
-    if(!this->hasStud(stud))
+    int index = this->stud_index(stud);
+    if(index < 0)
         return; // Return if the ship doesn't have this stud.
-    if(!this->studIsIntact(stud))
+    if(this->hitStuds & (1u << index))
         return; // Return if the stud is already destroyed.
-    for(size_t i = 0; i < this->intactStuds.size(); ++i) {
-        if(this->intactStuds[i] == stud) {
-            this->intactStuds.erase(this->intactStuds.begin() + i); // Remove stud from intact list.
-            break;
-        }
-    }
-    this->destroyedStuds.push_back(stud); // Add the stud to the destroyed list.
+    this->hitStuds |= 1u << index; // Mark the stud as destroyed.
+    if(--this->hitsLeft == 0)
+        this->status = SUNKEN; // The last intact stud is gone.
+}
+
+// Method: Takes the ship off the grid with every stud intact again, keeping the studs.
+void Ship::reset() {
+    for(int i = 0; i < this->numStuds; ++i)
+        this->shipStuds[i]->reset();
+    this->hitStuds = 0;
+    this->hitsLeft = this->numStuds;
+    this->status = AFLOAT;
+    this->isOnGrid = false;
+    this->isReady = false;
 }
@@ -4,10 +4,15 @@
 #include "Enums.h" // Include for enumerated types used in the class.
 #include "Grid.h" // Include for the Grid class.
 #include "Stud.h" // Include for the Stud class.
+#include "Arena.h" // Include for the per-game allocator of the studs.
+#include "View.h" // Include for the copy-free view of the studs.
 
 #include <vector> // Include for using vector class.
     using std::vector; // Use vector from the standard namespace.
 
+#include <array> // Include for using array class.
+    using std::array; // Use array from the standard namespace.
+
 #include <string> // Include for using string class.
     using std::string; // Use string from the standard namespace.
 
@@ -18,8 +23,11 @@ class Ship {
     protected:
         PlayerType ofPlayer; // The player type (CPU or human) that owns the ship.
         Grid* onGrid {nullptr}; // Pointer to the grid where the ship is placed.
-        vector<Stud*> intactStuds; // Vector of intact studs representing undamaged parts of the ship.
-        vector<Stud*> destroyedStuds; // Vector of destroyed studs representing damaged parts of the ship.
+        Arena* arena {nullptr}; // Allocator of the studs, taken from the grid (nullptr for the heap).
+        array<Stud*, 5> shipStuds {}; // The ship's studs in the order they were built; only the first numStuds are used.
+        int numStuds {0}; // Number of studs the ship has (its length).
+        unsigned hitStuds {0}; // Bit i is set once shipStuds[i] has been hit.
+        int hitsLeft {0}; // Hits still needed to sink the ship.
         ShipType shipType; // The type of the ship (e.g., Carrier, Battleship).
         string shipName; // The name of the ship (e.g., "Carrier").
         ShipStatus status {AFLOAT}; // The status of the ship (AFLOAT or SUNKEN).
@@ -29,19 +37,27 @@ class Ship {
         // Method to set the ship's name based on its type.
         void set_ship_name(ShipType ship_type);
 
+        // Method to find a stud's slot in shipStuds (-1 if the stud is not on this ship).
+        int stud_index(const Stud* stud) const;
+
+        // Method for derived classes to register each stud they build.
+        void add_stud(Stud* stud);
+
     public:
         // Constructors and Destructor.
         Ship(); // Default constructor.
         explicit Ship(ShipType ship_type); // Constructor initializing the ship type.
         Ship(ShipType ship_type, PlayerType of_player); // Constructor with ship type and player type.
         Ship(ShipType ship_type, Grid* on_grid); // Constructor with ship type and grid.
-        ~Ship(); // Destructor to clean up resources.
+        virtual ~Ship(); // Destructor to clean up resources; virtual as ships are deleted through Ship*.
 
         // Getter methods.
         PlayerType getOfPlayer() const; // Returns the player type owning the ship.
         Grid* getOnGrid() const; // Returns the grid the ship is on.
-        vector<Stud*> getIntactSutds() const; // Returns a vector of intact studs.
-        vector<Stud*> getDestroyedStuds() const; // Returns a vector of destroyed studs.
+        vector<Stud*> getIntactSutds() const; // Returns a vector of intact studs, built from the hit bits.
+        vector<Stud*> getDestroyedStuds() const; // Returns a vector of destroyed studs, built from the hit bits.
+        int getHitsLeft() const; // Returns the hits still needed to sink the ship.
+        View<Stud*> viewStuds() const; // Views every stud in build order without copying; wasHit tells them apart.
         ShipType getShipType() const; // Returns the type of the ship.
         string getShipName() const; // Returns the name of the ship.
         ShipStatus getShipStatus() const; // Returns the status of the ship.
@@ -63,10 +79,15 @@ class Ship {
         // Pure virtual methods to be implemented by derived classes.
         virtual void setStuds() = 0; // Method to set studs on the ship.
         virtual bool hasStud(Stud* stud) const = 0; // Checks if the ship has a specific stud.
-        virtual bool placeOnGrid(string start_space, char direction, bool print_out = true) const = 0; // Places the ship on the grid.
+        virtual bool placeOnGrid(SpaceName start_space, char direction, bool print_out = true) const = 0; // Places the ship on the grid.
+
+        // Places the ship from a space string such as "A1" (console input).
+        bool placeOnGrid(string start_space, char direction, bool print_out = true) const;
 
         // Method to mark a stud as destroyed.
         void destroyStud(Stud* stud);
+        // Method to take the ship off its grid and repair every stud for the next game.
+        void reset();
 };
 
 #endif // End of include guard.
@@ -0,0 +1,183 @@
+#include "Simulation.h"
+
+#include "Enums.h"   // CamdenType and PlayerType.
+#include "Game.h"    // Headless games.
+#include "Player.h"  // Shot counts of the players.
+#include "Random.h"  // Per-game engines.
+#include "Arena.h"   // Storage reused from game to game.
+#include "ReplayWriter.h" // Record of every game played.
+
+#include <string>
+    using std::string;
+
+#include <iostream>
+    using std::cout;
+    using std::endl;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+    using std::chrono::duration;
+
+#include <stdexcept>
+    using std::invalid_argument;
+
+// **SimulationStats: Add a Game**
+// Records the winner and the shots fired in a finished game.
+void SimulationStats::addGame(const Game& game) {
+    PlayerType winner = game.winner();
+    Player* winning_player = winner == MAN ? game.getHuman() : game.getCpu();
+    int shots_to_win = winning_player->getNumShots();
+    int shots = shots_to_win + winning_player->getFoe()->getNumShots();
+    if(winner == MAN)
+        ++this->rivalWins;
+    else
+        ++this->camdenWins;
+    if(this->games == 0 || shots_to_win < this->fewestShotsToWin)
+        this->fewestShotsToWin = shots_to_win;
+    if(this->games == 0 || shots_to_win > this->mostShotsToWin)
+        this->mostShotsToWin = shots_to_win;
+    this->totalShotsToWin += shots_to_win;
+    this->totalShots += shots;
+    ++this->games;
+}
+
+// **SimulationStats: Merge**
+// Adds another batch's totals; the caller times the combined batch itself.
+void SimulationStats::merge(const SimulationStats& other) {
+    if(other.games == 0)
+        return;
+    if(this->games == 0 || other.fewestShotsToWin < this->fewestShotsToWin)
+        this->fewestShotsToWin = other.fewestShotsToWin;
+    if(this->games == 0 || other.mostShotsToWin > this->mostShotsToWin)
+        this->mostShotsToWin = other.mostShotsToWin;
+    this->games += other.games;
+    this->rivalWins += other.rivalWins;
+    this->camdenWins += other.camdenWins;
+    this->totalShotsToWin += other.totalShotsToWin;
+    this->totalShots += other.totalShots;
+}
+
+// **SimulationStats: Mean Shots to Win**
+double SimulationStats::meanShotsToWin() const {
+    return this->games ? static_cast<double>(this->totalShotsToWin) / static_cast<double>(this->games) : 0.0;
+}
+
+// **SimulationStats: Mean Shots per Game**
+double SimulationStats::meanShots() const {
+    return this->games ? static_cast<double>(this->totalShots) / static_cast<double>(this->games) : 0.0;
+}
+
+// **SimulationStats: Throughput**
+double SimulationStats::gamesPerSecond() const {
+    return this->seconds > 0.0 ? static_cast<double>(this->games) / this->seconds : 0.0;
+}
+
+// **Constructor**
+Simulation::Simulation(CamdenType rival_type, CamdenType camden_type) : rivalType{rival_type}, camdenType{camden_type} {}
+
+// **Set the Replay Writer**
+void Simulation::setReplayWriter(ReplayWriter* replay_writer) {
+    this->replayWriter = replay_writer;
+}
+
+// **Set Camden's Prior**
+void Simulation::setCamdenPrior(const PlacementPrior* prior) {
+    this->camdenPrior = prior;
+}
+
+// **Set Camden's Search Budget**
+void Simulation::setCamdenBudget(const SearchBudget& budget) {
+    this->camdenBudget = budget;
+}
+
+// **Set the Heatmap Cache**
+void Simulation::setHeatmapCache(HeatmapCache* heatmap_cache) {
+    this->heatmapCache = heatmap_cache;
+}
+
+// **Play One Game**
+// Plays a game to the end through Game::playGame and records the result.
+// With an arena, the game's objects share one block that is rewound afterwards.
+void Simulation::playGame(uint64_t game_seed, SimulationStats& stats, Arena* arena) const {
+    {
+        Random rand_func(game_seed);
+        Game game(this->rivalType, this->camdenType, arena);
+        game.setCamdenPrior(this->camdenPrior);
+        game.setCamdenBudget(this->camdenBudget);
+        game.setHeatmapCache(this->heatmapCache);
+        game.playHeadlessGame(rand_func);
+        stats.addGame(game);
+        if(this->replayWriter)
+            this->replayWriter->append(game, game_seed);
+    }
+    if(arena)
+        arena->reset(); // The game and everything in the arena are gone.
+}
+
+// **Make a Reusable Game**
+// The caller frees it with Arena::destroy and the same arena.
+Game* Simulation::makeGame(Arena* arena) const {
+    Game* game = Arena::make<Game>(arena, this->rivalType, this->camdenType, arena);
+    game->setCamdenPrior(this->camdenPrior);
+    game->setCamdenBudget(this->camdenBudget);
+    game->setHeatmapCache(this->heatmapCache);
+    return game;
+}
+
+// **Replay a Game**
+// Resets the game's objects in place and plays it again, so nothing is built or
+// freed between games. Results match playing a new Game with the same seed.
+void Simulation::playGame(uint64_t game_seed, SimulationStats& stats, Game& game) const {
+    Random rand_func(game_seed);
+    game.reset();
+    game.playHeadlessGame(rand_func);
+    stats.addGame(game);
+    if(this->replayWriter)
+        this->replayWriter->append(game, game_seed);
+}
+
+// **Run a Batch**
+// Plays every game of the batch on the calling thread, all on one reused Game.
+SimulationStats Simulation::run(long num_games, uint64_t seed) const {
+    SimulationStats stats;
+    Arena arena;
+    Game* game = this->makeGame(&arena);
+    steady_clock::time_point start = steady_clock::now();
+    for(long i = 0; i < num_games; ++i)
+        this->playGame(Random::mix(seed, static_cast<uint64_t>(i)), stats, *game);
+    stats.seconds = duration<double>(steady_clock::now() - start).count();
+    Arena::destroy(&arena, game);
+    return stats;
+}
+
+// **Print a Summary**
+void Simulation::printStats(const SimulationStats& stats) {
+    cout << "Games:              " << stats.games << endl;
+    cout << "Rival wins:         " << stats.rivalWins << endl;
+    cout << "Camden wins:        " << stats.camdenWins << endl;
+    cout << "Mean shots to win:  " << stats.meanShotsToWin() << endl;
+    cout << "Shots to win range: " << stats.fewestShotsToWin << " - " << stats.mostShotsToWin << endl;
+    cout << "Mean shots a game:  " << stats.meanShots() << endl;
+    cout << "Seconds:            " << stats.seconds << endl;
+    cout << "Games per second:   " << stats.gamesPerSecond() << endl;
+}
+
+// **Parse a Strategy Name**
+CamdenType Simulation::typeFromString(string type_string) {
+    if(type_string == "random") return RANDOM;
+    if(type_string == "easy") return EASY;
+    if(type_string == "hard") return HARD;
+    if(type_string == "rollout") return ROLLOUT;
+    throw invalid_argument("Bad strategy: " + type_string);
+}
+
+// **Name a Strategy**
+string Simulation::stringFromType(CamdenType camden_type) {
+    switch(camden_type) {
+        case RANDOM: return "random";
+        case EASY: return "easy";
+        case HARD: return "hard";
+        case ROLLOUT: return "rollout";
+    }
+    return "unknown";
+}
@@ -0,0 +1,73 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "Enums.h"   // Includes CamdenType for the two strategies being compared.
+#include "Game.h"    // Headless games are played through the Game class.
+#include "Random.h"  // Each game gets its own seeded engine.
+#include "Arena.h"   // Storage reused from game to game.
+#include "ReplayWriter.h" // Optional record of every game played.
+#include "HeatmapCache.h" // Optional weights shared between games.
+
+#include <string>
+    using std::string;
+
+#include <cstdint>
+    using std::uint64_t;
+
+// **SimulationStats Struct**
+// Running totals for a batch of headless games.
+struct SimulationStats {
+    long games {0};            // Number of games played.
+    long rivalWins {0};        // Games won by the AI in the human's seat.
+    long camdenWins {0};       // Games won by the AI in the CPU's seat.
+    long totalShotsToWin {0};  // Sum over games of the shots fired by the winner.
+    long totalShots {0};       // Sum over games of the shots fired by both sides.
+    int fewestShotsToWin {0};  // Best winning shot count seen.
+    int mostShotsToWin {0};    // Worst winning shot count seen.
+    double seconds {0.0};      // Wall-clock time spent playing.
+
+    void addGame(const Game& game);       // Adds the outcome of a finished game.
+    void merge(const SimulationStats& other); // Folds in another batch's totals (seconds are not added).
+    double meanShotsToWin() const;        // Average shots the winner needed.
+    double meanShots() const;             // Average shots per game, both sides.
+    double gamesPerSecond() const;        // Throughput of the batch.
+};
+
+// **Simulation Class**
+// Plays batches of CPU-vs-CPU games with no console I/O or delays.
+// Game i of a batch is seeded with Random::mix(seed, i), so a batch gives the
+// same totals whether it is played here or split across a Tournament's threads.
+class Simulation {
+    private:
+        CamdenType rivalType;   // Strategy in the human's seat.
+        CamdenType camdenType;  // Strategy in the CPU's seat.
+        ReplayWriter* replayWriter {nullptr}; // Receives every finished game, or nullptr to keep none.
+        const PlacementPrior* camdenPrior {nullptr}; // Hunting weights of the CPU's seat, or nullptr for none.
+        SearchBudget camdenBudget;  // Work per move of a ROLLOUT CPU's seat.
+        HeatmapCache* heatmapCache {nullptr}; // Weights shared by the HARD seats of every game, or nullptr for none.
+
+    public:
+        // **Constructor**
+        Simulation(CamdenType rival_type, CamdenType camden_type);
+
+        // **Recording Games**
+        void setReplayWriter(ReplayWriter* replay_writer); // Appends every game played from now on; nullptr stops recording.
+
+        // **Priors**
+        void setCamdenPrior(const PlacementPrior* prior); // Hunting weights for the CPU's seat in games made from now on.
+        void setCamdenBudget(const SearchBudget& budget); // Work per ROLLOUT move of the CPU's seat in games made from now on.
+        void setHeatmapCache(HeatmapCache* heatmap_cache); // Weights shared by HARD seats in games made from now on; nullptr for none.
+
+        // **Running Games**
+        void playGame(uint64_t game_seed, SimulationStats& stats, Arena* arena = nullptr) const; // Plays one seeded game into stats, reusing arena if given.
+        void playGame(uint64_t game_seed, SimulationStats& stats, Game& game) const; // Resets a game made by makeGame and replays it with a new seed.
+        Game* makeGame(Arena* arena = nullptr) const; // A headless game of this batch's strategies, to be replayed with playGame.
+        SimulationStats run(long num_games, uint64_t seed) const; // Plays num_games games back to back.
+
+        // **Reporting**
+        static void printStats(const SimulationStats& stats);  // Prints a summary of a batch.
+        static CamdenType typeFromString(string type_string);  // Parses "random", "easy", "hard" or "rollout".
+        static string stringFromType(CamdenType camden_type);  // Names a strategy for reports.
+};
+
+#endif
@@ -0,0 +1,85 @@
+#include "SpaceSet.h" // Include SpaceSet header file.
+
+#include "Enums.h" // Include for the SpaceName enumeration.
+#include "Bitboard.h" // Include for the membership mask.
+
+#include <vector> // Include for using vector class.
+    using std::vector; // Use vector from the standard namespace.
+
+#include <cstddef> // Include for size_t.
+    using std::size_t; // Use size_t from the standard namespace.
+
+// Constructor: Starts with no members.
+SpaceSet::SpaceSet() {}
+
+// Method: Builds the set of all spaces, packed from A1 to J10.
+SpaceSet SpaceSet::all() {
+    SpaceSet space_set;
+    for(SpaceName space_name : Spaces::spaceNames)
+        space_set.insert(space_name);
+    return space_set;
+}
+
+// Getter: Returns the number of members.
+size_t SpaceSet::size() const {
+    return this->count;
+}
+
+// Getter: Returns whether the set has no members.
+bool SpaceSet::empty() const {
+    return this->count == 0;
+}
+
+// Getter: Returns the members as a Bitboard.
+Bitboard SpaceSet::mask() const {
+    return this->members;
+}
+
+// Getter: Returns the member packed at the given index.
+SpaceName SpaceSet::at(size_t index) const {
+    return this->dense[index];
+}
+
+// Method: Checks if a space is a member with one bit test.
+bool SpaceSet::contains(SpaceName space_name) const {
+    return this->members.has(space_name);
+}
+
+// Method: Appends a space to the packed array if it is not already a member.
+void SpaceSet::insert(SpaceName space_name) {
+    if(this->contains(space_name))
+        return;
+    this->members |= Bitboard::of(space_name);
+    this->slots[space_name - 1] = static_cast<unsigned char>(this->count);
+    this->dense[this->count++] = space_name;
+}
+
+// Method: Removes a space by moving the last packed member into its slot.
+void SpaceSet::remove(SpaceName space_name) {
+    if(!this->contains(space_name))
+        return;
+    this->members &= ~Bitboard::of(space_name);
+    size_t slot = this->slots[space_name - 1];
+    SpaceName last = this->dense[--this->count];
+    this->dense[slot] = last;
+    this->slots[last - 1] = static_cast<unsigned char>(slot);
+}
+
+// Method: Removes each space of a vector.
+void SpaceSet::remove(const vector<SpaceName>& space_names) {
+    for(SpaceName space_name : space_names)
+        this->remove(space_name);
+}
+
+// Method: Removes every member that is also in the mask.
+void SpaceSet::remove(Bitboard spaces) {
+    Bitboard leaving = spaces & this->members;
+    while(leaving.any())
+        this->remove(static_cast<SpaceName>(leaving.popLowest() + 1));
+}
+
+// Method: Empties the set.
+void SpaceSet::clear() {
+    this->members = Bitboard();
+    this->count = 0;
+}
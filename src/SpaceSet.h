@@ -0,0 +1,47 @@
+#ifndef SPACESET_H // Include guard to prevent multiple inclusions.
+#define SPACESET_H
+
+#include <array> // Include for using array class.
+    using std::array; // Use array from the standard namespace.
+
+#include <vector> // Include for using vector class.
+    using std::vector; // Use vector from the standard namespace.
+
+#include <cstddef> // Include for size_t.
+    using std::size_t; // Use size_t from the standard namespace.
+
+#include "Enums.h" // Include for the SpaceName enumeration.
+#include "Bitboard.h" // Include for the membership mask.
+
+// Declaration of the SpaceSet class, a set of grid spaces with constant-time
+// membership, insertion, removal and indexing. Members are kept both as a Bitboard
+// and packed at the front of an array; removal moves the last member into the hole,
+// so the packed order is not grid order.
+class SpaceSet {
+    private:
+        Bitboard members; // Bit per member space.
+        array<SpaceName, 100> dense {}; // Members packed into [0, count).
+        array<unsigned char, 100> slots {}; // Position in dense of each member, by bit index.
+        size_t count {0}; // Number of members.
+
+    public:
+        // Constructors.
+        SpaceSet(); // Empty set.
+        static SpaceSet all(); // Set of all 100 spaces, packed in grid order.
+
+        // Getter methods.
+        size_t size() const; // Returns the number of members.
+        bool empty() const; // Returns whether the set has no members.
+        Bitboard mask() const; // Returns the members as a Bitboard.
+        SpaceName at(size_t index) const; // Returns the member packed at index (0 to size() - 1).
+
+        // Methods to query and change the set.
+        bool contains(SpaceName space_name) const; // Checks if a space is a member.
+        void insert(SpaceName space_name); // Adds a space; no effect if already a member.
+        void remove(SpaceName space_name); // Removes a space; no effect if not a member.
+        void remove(const vector<SpaceName>& space_names); // Removes each given space.
+        void remove(Bitboard spaces); // Removes every space of a mask.
+        void clear(); // Removes every member.
+};
+
+#endif // End of include guard.
@@ -151,3 +151,11 @@ void Stud::hit() {
     if(this->ofShip != nullptr)
         this->ofShip->destroyStud(this); // Notify the ship that the stud was hit.
 }
+
+// Method: Takes the stud off the grid and makes it intact again, as it was when built.
+void Stud::reset() {
+    this->status = INTACT; // Undo any hit.
+    this->onSpace = NO_SPACE; // Not on any space until the ship is placed again.
+    this->gridspace = nullptr;
+    this->set_ship_type(this->studName); // Restore the upper-case label.
+}
@@ -57,6 +57,7 @@ class Stud {
         // Methods to check and update the status of the Stud.
         bool wasHit() const; // Checks if the Stud was hit (status is COMPROMISED).
         void hit(); // Marks the Stud as hit, updates the label, and notifies the Ship.
+        void reset(); // Puts the Stud back off the grid and intact, for the next game.
 };
 
 #endif // End of include guard.
@@ -3,6 +3,7 @@
 
 #include "Enums.h"
 #include "Grid.h"
+#include "Placements.h"
 #include "Stud.h"
 
 #include <string>
@@ -11,9 +12,6 @@
 #include <array>
     using std::array;
 
-#include <stdexcept>
-    using std::out_of_range;
-
 #include <iostream>
     using std::cout;
     using std::endl;
@@ -46,7 +44,7 @@ Submarine::Submarine(Grid* on_grid, string start_space, char direction) : Ship (
 // Cleans up dynamically allocated memory for the studs of the Submarine.
 Submarine::~Submarine() {
     for(size_t i = 0; i < 3; ++i) { // Submarines have 3 studs.
-        delete this->studs[i]; // Deletes each stud.
+        Arena::destroy(this->arena, this->studs[i]); // Deletes each stud.
         this->studs[i] = nullptr; // Sets the pointer to null to prevent dangling references.
     }
 } 
@@ -77,40 +75,36 @@ bool Submarine::hasStud(Stud* stud) const {
 // Sets up the 3 studs for the Submarine, assigns names, and links them to the Submarine.
 void Submarine::setStuds() {
     for(size_t i=12, j=0; i<15; i++, j++) { // Submarine's studs are indexed 12-14.
-        this->studs[j] = new Stud(Studs::studNames[i], this->ofPlayer, this); // Creates a new stud.
-        this->intactStuds.push_back(this->studs[j]); // Adds the stud to the intact studs list.
+        this->studs[j] = Arena::make<Stud>(this->arena, Studs::studNames[i], this->ofPlayer, this); // Creates a new stud.
+        this->add_stud(this->studs[j]); // Adds the stud to the intact studs list.
     }
 }
 
 // **Place Submarine on Grid**
 // Places the Submarine on the grid, ensuring the placement is valid and doesn't conflict with other ships.
-bool Submarine::placeOnGrid(string start_space, char direction, bool print_out) const {
-    vector<string> ship_spaces; // List of spaces the ship will occupy.
-
-    try {
-        // Calculates the spaces based on the starting point and direction.
-        ship_spaces = Grid::getVector(start_space, direction, 2); // Submarine occupies 3 spaces.
-    } catch (out_of_range& e) {
+bool Submarine::placeOnGrid(SpaceName start_space, char direction, bool print_out) const {
+    // Look up the Submarine's spaces and halo in the placement table (Submarine has a length of 3).
+    const Placement& placement = Placements::at(3, start_space, direction);
+    if(!placement.fits()) {
+        // Handle placements that would run off the grid.
         if(print_out)
-            cout << "Out of range." << endl; // Prints an error if placement is out of bounds.
-        return false;
+            cout << "Out of range." << endl;
+        return false; // Placement failed.
     }
 
-    // Checks if the calculated spaces are invalid (e.g., overlap or adjacent to other ships).
-    if(this->onGrid->hasNoGoSpace(ship_spaces)) {
+    // Check if any of the intended spaces are occupied by or adjacent to other ships.
+    if(!this->onGrid->canPlace(placement)) {
         if(print_out)
-            cout << "Ships cannot be touching." << endl; // Prints an error if the placement is invalid.
-        return false;
+            cout << "Ships cannot be touching." << endl;
+        return false; // Placement failed.
     }
 
-    // Places each stud of the Submarine on the corresponding grid spaces.
-    for(size_t i = 0; i < 3; i++)
-        this->onGrid->setOnSpace(ship_spaces[i], this->studs[i]);
+    // Place the Submarine's studs on the grid.
+    for(int i = 0; i < 3; i++)
+        this->onGrid->setOnSpace(placement.spaceAt(i), this->studs[i]);
 
-    // Adds neighboring spaces to the "no-go" list to prevent other ships from being placed too close.
-    vector<string> ship_neighbors = Grid::neighborSpaces(ship_spaces);
-    this->onGrid->addNoGoSpaces(ship_spaces); // Marks the ship's spaces as occupied.
-    this->onGrid->addNoGoSpaces(ship_neighbors); // Marks the neighboring spaces as restricted.
+    // Mark the Submarine's spaces and their neighbors as no-go zones.
+    this->onGrid->addNoGoSpaces(placement.mask | placement.halo);
 
     return true; // Returns true if the placement is successful.
 }
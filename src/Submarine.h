@@ -37,7 +37,8 @@ class Submarine : public Ship {
         void setStuds() override;
 
         // Method to place the Submarine on the grid.
-        bool placeOnGrid(string start_space, char direction, bool print_out = false) const override;
+        using Ship::placeOnGrid; // Keeps the string overload from Ship visible.
+        bool placeOnGrid(SpaceName start_space, char direction, bool print_out = false) const override;
 };
 
 #endif // End of include guard.
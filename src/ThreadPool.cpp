@@ -0,0 +1,103 @@
+#include "ThreadPool.h"
+
+#include <cstddef>
+    using std::size_t;
+
+#include <atomic>
+    using std::atomic;
+
+#include <algorithm>
+    using std::min;
+
+#include <thread>
+    using std::thread;
+
+#include <mutex>
+    using std::unique_lock;
+
+#include <functional>
+    using std::function;
+
+// **Constructor**
+// Starts the workers; they sleep until a job arrives.
+ThreadPool::ThreadPool(size_t num_threads) {
+    if(num_threads == 0)
+        num_threads = defaultThreads();
+    this->workers.reserve(num_threads);
+    for(size_t i = 0; i < num_threads; ++i)
+        this->workers.emplace_back(&ThreadPool::worker_loop, this, i);
+}
+
+// **Destructor**
+// Wakes every worker to exit and joins them.
+ThreadPool::~ThreadPool() {
+    {
+        unique_lock<mutex> guard(this->lock);
+        this->stopping = true;
+    }
+    this->wake.notify_all();
+    for(thread& worker : this->workers)
+        worker.join();
+}
+
+// **Worker Loop**
+// Waits for each new generation, runs the job once and reports back.
+void ThreadPool::worker_loop(size_t worker) {
+    unsigned long seen = 0;
+    for(;;) {
+        function<void(size_t)> task;
+        {
+            unique_lock<mutex> guard(this->lock);
+            this->wake.wait(guard, [&] { return this->stopping || this->generation != seen; });
+            if(this->stopping)
+                return;
+            seen = this->generation;
+            task = this->job;
+        }
+        task(worker);
+        {
+            unique_lock<mutex> guard(this->lock);
+            if(--this->running == 0)
+                this->done.notify_one();
+        }
+    }
+}
+
+// **Size**
+size_t ThreadPool::size() const {
+    return this->workers.size();
+}
+
+// **Run on All Workers**
+// One job at a time: the caller blocks until every worker has returned from task.
+void ThreadPool::runOnAll(const function<void(size_t)>& task) {
+    unique_lock<mutex> guard(this->lock);
+    this->job = task;
+    this->running = this->workers.size();
+    ++this->generation;
+    this->wake.notify_all();
+    this->done.wait(guard, [&] { return this->running == 0; });
+    this->job = nullptr;
+}
+
+// **Parallel For**
+// Workers claim chunks from a shared counter until the range is used up.
+void ThreadPool::parallelFor(size_t count, size_t chunk_size, const function<void(size_t, size_t, size_t)>& body) {
+    if(chunk_size == 0)
+        chunk_size = 1;
+    atomic<size_t> next {0};
+    this->runOnAll([&](size_t worker) {
+        for(;;) {
+            size_t begin = next.fetch_add(chunk_size, std::memory_order_relaxed);
+            if(begin >= count)
+                return;
+            body(worker, begin, min(begin + chunk_size, count));
+        }
+    });
+}
+
+// **Default Thread Count**
+size_t ThreadPool::defaultThreads() {
+    unsigned int hardware = thread::hardware_concurrency();
+    return hardware ? hardware : 1;
+}
@@ -0,0 +1,55 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <cstddef>
+    using std::size_t;
+
+#include <vector>
+    using std::vector;
+
+#include <thread>
+    using std::thread;
+
+#include <mutex>
+    using std::mutex;
+
+#include <condition_variable>
+    using std::condition_variable;
+
+#include <functional>
+    using std::function;
+
+// **ThreadPool Class**
+// A fixed set of worker threads that run one job at a time on every worker.
+// Work is handed out in chunks from a shared atomic counter, so a worker that
+// finishes early simply claims the next chunk instead of sitting idle.
+class ThreadPool {
+    private:
+        vector<thread> workers;             // The worker threads.
+        mutex lock;                         // Guards everything below.
+        condition_variable wake;            // Signals a new job or shutdown.
+        condition_variable done;            // Signals that every worker finished the job.
+        function<void(size_t)> job;         // Current job, called with the worker's index.
+        unsigned long generation {0};       // Bumped for every new job.
+        size_t running {0};                 // Workers still busy with the current job.
+        bool stopping {false};              // Set by the destructor.
+
+        void worker_loop(size_t worker);    // Body of each worker thread.
+
+    public:
+        // **Constructor and Destructor**
+        explicit ThreadPool(size_t num_threads = 0); // 0 means one thread per hardware thread.
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // **Running Jobs**
+        size_t size() const;                                // Number of workers.
+        void runOnAll(const function<void(size_t)>& task);  // Runs task(worker) on every worker and waits.
+        // Calls body(worker, begin, end) over [0, count) in chunks of up to chunk_size items and waits.
+        void parallelFor(size_t count, size_t chunk_size, const function<void(size_t, size_t, size_t)>& body);
+
+        static size_t defaultThreads();                     // Hardware threads, at least 1.
+};
+
+#endif
@@ -0,0 +1,83 @@
+#include "Tournament.h"
+
+#include "Enums.h"       // CamdenType.
+#include "Simulation.h"  // SimulationStats and single games.
+#include "Random.h"      // Per-game seeds.
+#include "Arena.h"       // Per-worker game storage.
+#include "Game.h"        // The game each worker replays.
+
+#include <cstddef>
+    using std::size_t;
+
+#include <cstdint>
+    using std::uint64_t;
+
+#include <vector>
+    using std::vector;
+
+#include <chrono>
+    using std::chrono::steady_clock;
+    using std::chrono::duration;
+
+// Per-worker totals and game storage, each on its own cache lines so workers never write to a shared line.
+// The game is made on the worker's first chunk and replayed for every later game.
+struct alignas(64) WorkerState {
+    SimulationStats stats;
+    Arena arena;
+    Game* game {nullptr};
+    WorkerState() = default;
+    WorkerState(const WorkerState&) = delete;
+    ~WorkerState() { Arena::destroy(&this->arena, this->game); }
+};
+
+// **Constructor**
+Tournament::Tournament(CamdenType rival_type, CamdenType camden_type, size_t num_threads, size_t chunk_size)
+    : simulation{rival_type, camden_type}, pool{num_threads}, chunkSize{chunk_size} {}
+
+// **Set the Replay Writer**
+// Records arrive in the order games finish, which depends on the thread count;
+// each record carries its seed.
+void Tournament::setReplayWriter(ReplayWriter* replay_writer) {
+    this->simulation.setReplayWriter(replay_writer);
+}
+
+// **Set Camden's Prior**
+void Tournament::setCamdenPrior(const PlacementPrior* prior) {
+    this->simulation.setCamdenPrior(prior);
+}
+
+// **Set the Heatmap Cache**
+void Tournament::setHeatmapCache(HeatmapCache* heatmap_cache) {
+    this->simulation.setHeatmapCache(heatmap_cache);
+}
+
+// **Set Camden's Search Budget**
+void Tournament::setCamdenBudget(const SearchBudget& budget) {
+    this->simulation.setCamdenBudget(budget);
+}
+
+// **Run a Batch**
+// Workers claim chunks of game numbers, play them into their own totals, and the
+// totals are merged at the end.
+SimulationStats Tournament::run(long num_games, uint64_t seed) {
+    vector<WorkerState> workers(this->pool.size());
+    steady_clock::time_point start = steady_clock::now();
+    this->pool.parallelFor(num_games > 0 ? static_cast<size_t>(num_games) : 0, this->chunkSize,
+        [&](size_t worker, size_t begin, size_t end) {
+            WorkerState& state = workers[worker];
+            if(state.game == nullptr)
+                state.game = this->simulation.makeGame(&state.arena);
+            for(size_t i = begin; i < end; ++i)
+                this->simulation.playGame(Random::mix(seed, i), state.stats, *state.game);
+        });
+    SimulationStats total;
+    for(const WorkerState& state : workers)
+        total.merge(state.stats);
+    total.seconds = duration<double>(steady_clock::now() - start).count();
+    return total;
+}
+
+// **Thread Count**
+size_t Tournament::getThreads() const {
+    return this->pool.size();
+}
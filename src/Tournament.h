@@ -0,0 +1,45 @@
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include "Enums.h"       // CamdenType of the two seats.
+#include "Simulation.h"  // Plays the individual games and holds their totals.
+#include "ThreadPool.h"  // Workers that play the games.
+#include "ReplayWriter.h" // Optional record of every game played.
+#include "HeatmapCache.h" // Optional weights shared by every worker.
+
+#include <cstddef>
+    using std::size_t;
+
+#include <cstdint>
+    using std::uint64_t;
+
+// **Tournament Class**
+// Plays a batch of headless games across a pool of worker threads.
+// Each game carries its own Random seeded from the batch seed and its game number,
+// and each worker keeps its own SimulationStats and game Arena, so the workers share
+// no mutable state or allocator (apart from a ReplayWriter and a HeatmapCache,
+// which lock); the per-worker totals are merged once the batch is done.
+class Tournament {
+    private:
+        Simulation simulation;  // Strategies of the two seats.
+        ThreadPool pool;        // Worker threads, kept alive across runs.
+        size_t chunkSize;       // Games a worker claims at a time.
+
+    public:
+        // **Constructor**
+        Tournament(CamdenType rival_type, CamdenType camden_type, size_t num_threads = 0, size_t chunk_size = 64);
+
+        // **Recording Games**
+        void setReplayWriter(ReplayWriter* replay_writer); // Every worker appends its games to the same writer.
+
+        // **Priors**
+        void setCamdenPrior(const PlacementPrior* prior); // Hunting weights for the CPU's seat; the prior is shared read-only.
+        void setCamdenBudget(const SearchBudget& budget); // Work per ROLLOUT move; its pool must not be this tournament's.
+        void setHeatmapCache(HeatmapCache* heatmap_cache); // Weights shared by the HARD seats of every worker; the cache locks.
+
+        // **Running Games**
+        SimulationStats run(long num_games, uint64_t seed); // Same totals as Simulation::run for any thread count.
+        size_t getThreads() const;                          // Number of worker threads.
+};
+
+#endif
@@ -0,0 +1,46 @@
+/* A View is a read-only window onto elements stored somewhere else, such as the
+first few slots of an array or the contents of a vector. It holds a pointer and a
+length and copies nothing, so getters can hand out their state without allocating.
+A View stays valid only as long as the storage behind it is not changed. */
+
+#ifndef VIEW_H // Include guard to prevent multiple inclusions.
+#define VIEW_H
+
+#include <cstddef> // Include for size_t.
+    using std::size_t; // Use size_t from the standard namespace.
+
+#include <array> // Include for using array class.
+    using std::array; // Use array from the standard namespace.
+
+#include <vector> // Include for using vector class.
+    using std::vector; // Use vector from the standard namespace.
+
+// Declaration of the View class template, a pointer and a length.
+template <typename T>
+class View {
+    private:
+        const T* first {nullptr}; // First element, or nullptr for an empty view.
+        size_t length {0}; // Number of elements.
+
+    public:
+        // Constructors.
+        constexpr View() {} // Empty view.
+        constexpr View(const T* the_first, size_t the_length) : first{the_first}, length{the_length} {} // The elements from the_first on.
+        template <size_t N>
+        constexpr View(const array<T, N>& elements) : first{elements.data()}, length{N} {} // A whole array.
+        View(const vector<T>& elements) : first{elements.data()}, length{elements.size()} {} // A whole vector.
+
+        // Element access.
+        constexpr const T* begin() const { return this->first; }
+        constexpr const T* end() const { return this->first + this->length; }
+        constexpr const T& operator[](size_t index) const { return this->first[index]; }
+
+        // Size queries.
+        constexpr size_t size() const { return this->length; }
+        constexpr bool empty() const { return this->length == 0; }
+
+        // Copies the elements out, for callers that need to keep or change them.
+        vector<T> toVector() const { return vector<T>(this->begin(), this->end()); }
+};
+
+#endif // End of include guard.
@@ -0,0 +1,56 @@
+#include "ReplayReader.h" // Include the memory-mapped replay reader.
+#include "ReplayAnalytics.h" // Include the replay counts and reports.
+#include "ThreadPool.h" // Include the workers that scan the corpus.
+#include "PlacementPrior.h" // Include the prior file writer.
+#include <iostream> // Include for input-output operations.
+    using std::cout; // Use cout for console output.
+    using std::cerr; // Use cerr for error output.
+    using std::endl; // Use endl for line breaks.
+#include <string> // Include for handling strings.
+    using std::string; // Use string from the standard namespace.
+#include <cstdlib> // Include for strtol.
+#include <chrono> // Include for timing the scan.
+#include <stdexcept> // Include for catching unreadable files.
+
+// Entry point for mining a replay corpus written by simulate.
+// Usage: analyze <replay file> [threads] [prior file] [seat]
+// Prints heatmaps of where each seat's fleets lay, where they were shot and hit,
+// and how many shots each ship took to sink. With a prior file, writes where the
+// seat's fleets lay (rival by default, or camden) in the form simulate loads for a
+// hard Camden. Threads default to one per hardware thread.
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        cerr << "Usage: analyze <replay file> [threads] [prior file] [seat]" << endl;
+        return 1;
+    }
+    long num_threads = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 0; // 0 picks the hardware thread count.
+    string seat = argc > 4 ? argv[4] : "rival"; // Seat whose fleets the prior describes.
+    if (seat != "rival" && seat != "camden") {
+        cerr << "Bad seat: " << seat << endl;
+        return 1;
+    }
+
+    try {
+        ReplayReader reader(argv[1]);
+        ThreadPool pool(num_threads > 0 ? static_cast<size_t>(num_threads) : 0);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ReplayAnalytics analytics = ReplayAnalytics::scan(reader, pool);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        analytics.printReport(cout);
+        cout << endl;
+        cout << "Threads:            " << pool.size() << endl;
+        cout << "Seconds:            " << seconds << endl;
+        cout << "Shots per second:   " << (seconds > 0.0 ? static_cast<double>(analytics.shots) / seconds : 0.0) << endl;
+
+        if (argc > 3) {
+            PlacementPrior prior = analytics.prior(seat == "rival" ? MAN : CPU);
+            prior.save(argv[3], seat + " fleets of " + std::to_string(analytics.games) + " games in " + argv[1]);
+            cout << "Prior written:      " << argv[3] << endl;
+        }
+    } catch (std::runtime_error& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,374 @@
+#include "BenchmarkSuite.h" // Include the timing harness and reports.
+#include "Game.h" // Include the Game class for Camden positions.
+#include "Player.h" // Include the Player class for the object-model placement paths.
+#include "Grid.h" // Include the Grid class for targeting and neighbors.
+#include "Carrier.h" // Include the ship classes for placement.
+#include "Battleship.h"
+#include "Destroyer.h"
+#include "Submarine.h"
+#include "Cruiser.h"
+#include "Placements.h" // Include the placement table for legal starts.
+#include "FleetGenerator.h" // Include the mask-based fleet generator.
+#include "FleetPerft.h" // Include the fleet counter.
+#include "Simulation.h" // Include whole headless games.
+#include "GameState.h" // Include the value-type game state.
+#include "Random.h" // Include the random number engine.
+#include "Arena.h" // Include the per-game allocator.
+#include <iostream> // Include for input-output operations.
+    using std::cout; // Use cout for the report.
+    using std::cerr; // Use cerr for progress and errors.
+    using std::endl; // Use endl for line breaks.
+#include <string> // Include for handling strings.
+    using std::string; // Use string from the standard namespace.
+#include <array> // Include for fixed batches of objects.
+    using std::array; // Use array from the standard namespace.
+#include <vector> // Include for lists of spaces.
+    using std::vector; // Use vector from the standard namespace.
+#include <algorithm> // Include for batch sizes.
+    using std::min; // Use min from the standard namespace.
+#include <cstdlib> // Include for strtol, strtod and strtoull.
+#include <cstdint> // Include for the 64-bit seed.
+#include <stdexcept> // Include for reporting a bad baseline.
+
+// Objects set up together and then measured in one stopwatch lap, so the clock is read once per batch.
+const int BATCH = 16;
+
+// Function prototypes for the groups of cases.
+void add_grid_cases(BenchmarkSuite& suite, uint64_t seed);
+void add_placement_cases(BenchmarkSuite& suite, uint64_t seed);
+void add_fleet_cases(BenchmarkSuite& suite, uint64_t seed);
+void add_camden_cases(BenchmarkSuite& suite, uint64_t seed);
+void add_game_cases(BenchmarkSuite& suite, uint64_t seed);
+void add_state_cases(BenchmarkSuite& suite, uint64_t seed);
+bool play_until(Game& game, int cpu_shots, Random& rand_func);
+
+// Entry point for the engine microbenchmarks.
+// Usage: benchmark [reps] [format] [baseline] [tolerance] [seed]
+// format is text, csv or json. baseline is a CSV written by an earlier "csv" run ("-" for none);
+// with one, a case whose median is more than tolerance percent (default 10) slower fails the run.
+// Exit status: 0 if no case regressed, 1 for bad arguments, 2 for a regression.
+int main(int argc, char* argv[]) {
+    int reps = argc > 1 ? static_cast<int>(std::strtol(argv[1], nullptr, 10)) : 7; // Timed repetitions per case.
+    string format = argc > 2 ? argv[2] : "text"; // Report format.
+    string baseline_path = argc > 3 ? argv[3] : "-"; // Baseline CSV, or "-".
+    double tolerance = argc > 4 ? std::strtod(argv[4], nullptr) : 10.0; // Allowed slowdown in percent.
+    uint64_t seed = argc > 5 ? static_cast<uint64_t>(std::strtoull(argv[5], nullptr, 10)) : 1; // Seed for every case.
+    if (format != "text" && format != "csv" && format != "json") {
+        cerr << "Bad format: " << format << " (use text, csv or json)" << endl;
+        return 1;
+    }
+
+    BenchmarkSuite suite(reps, tolerance);
+    if (baseline_path != "-") {
+        try {
+            suite.loadBaseline(baseline_path);
+        } catch (std::exception& e) {
+            cerr << e.what() << endl;
+            return 1;
+        }
+    }
+    add_grid_cases(suite, seed);
+    add_placement_cases(suite, seed);
+    add_fleet_cases(suite, seed);
+    add_camden_cases(suite, seed);
+    add_game_cases(suite, seed);
+    add_state_cases(suite, seed);
+
+    suite.run(&cerr); // Progress goes to stderr so stdout holds only the report.
+    if (format == "csv")
+        suite.printCsv(cout);
+    else if (format == "json")
+        suite.printJson(cout);
+    else
+        suite.printText(cout);
+    return suite.hasRegression() ? 2 : 0;
+}
+
+// Function to add the Grid and Spaces cases: targeting, neighbor lists and space-string parsing.
+void add_grid_cases(BenchmarkSuite& suite, uint64_t seed) {
+    // Grid::target: every space of a dealt grid in a random order, one lap per grid.
+    suite.add("grid_target", 200000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        Player player(CPU);
+        vector<SpaceName> order(Spaces::spaceNames, Spaces::spaceNames + 100);
+        long done = 0;
+        while (done < ops) {
+            player.reset();
+            player.autoSetShips(rand_func);
+            for (int i = 99; i > 0; --i) // Shuffle the firing order.
+                std::swap(order[i], order[rand_func.below(i + 1)]);
+            long shots = min<long>(100, ops - done);
+            Grid* grid = player.getGrid();
+            watch.start();
+            for (long i = 0; i < shots; ++i)
+                BenchmarkSuite::keep(grid->target(order[i]));
+            watch.stop();
+            done += shots;
+        }
+    });
+
+    // Grid::neighborSpaces: the neighbor list of each space in turn.
+    suite.add("grid_neighbor_spaces", 1000000, [](long ops, Stopwatch& watch) {
+        watch.start();
+        for (long i = 0; i < ops; ++i)
+            BenchmarkSuite::keep(Grid::neighborSpaces(Spaces::spaceNames[i % 100]).size());
+        watch.stop();
+    });
+
+    // Spaces::nameFromString: each of the 100 space strings in turn.
+    suite.add("spaces_name_from_string", 2000000, [](long ops, Stopwatch& watch) {
+        vector<string> space_strings;
+        for (SpaceName space_name : Spaces::spaceNames)
+            space_strings.push_back(Spaces::stringFromName(space_name));
+        watch.start();
+        for (long i = 0; i < ops; ++i)
+            BenchmarkSuite::keep(Spaces::nameFromString(space_strings[i % 100]));
+        watch.stop();
+    });
+}
+
+// Function template to add the placeOnGrid case of one ship class: a legal random
+// placement on each of a batch of empty grids, which are cleared untimed afterwards.
+template <typename T>
+void add_placement_case(BenchmarkSuite& suite, string name, int length, uint64_t seed) {
+    suite.add(name, 200000, [=](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        array<Grid*, BATCH> grids;
+        array<T*, BATCH> ships;
+        array<const Placement*, BATCH> placements;
+        for (int i = 0; i < BATCH; ++i) {
+            grids[i] = new Grid(CPU);
+            ships[i] = new T(grids[i]);
+        }
+        const Placement* lines = Placements::begin(length);
+        int num_lines = Placements::count(length);
+        long done = 0;
+        while (done < ops) {
+            int batch = static_cast<int>(min<long>(BATCH, ops - done));
+            for (int i = 0; i < batch; ++i) {
+                grids[i]->reset();
+                ships[i]->reset();
+                placements[i] = &lines[rand_func.below(num_lines)];
+            }
+            watch.start();
+            for (int i = 0; i < batch; ++i)
+                BenchmarkSuite::keep(ships[i]->placeOnGrid(placements[i]->start, placements[i]->direction(), false));
+            watch.stop();
+            done += batch;
+        }
+        for (int i = 0; i < BATCH; ++i) {
+            delete ships[i];
+            delete grids[i];
+        }
+    });
+}
+
+// Function to add placeOnGrid for each ship class.
+void add_placement_cases(BenchmarkSuite& suite, uint64_t seed) {
+    add_placement_case<Carrier>(suite, "carrier_place_on_grid", 5, seed);
+    add_placement_case<Battleship>(suite, "battleship_place_on_grid", 4, seed);
+    add_placement_case<Destroyer>(suite, "destroyer_place_on_grid", 3, seed);
+    add_placement_case<Submarine>(suite, "submarine_place_on_grid", 3, seed);
+    add_placement_case<Cruiser>(suite, "cruiser_place_on_grid", 2, seed);
+}
+
+// Function to add the fleet cases: Player::autoSetShips, the old retry path and the generator alone.
+void add_fleet_cases(BenchmarkSuite& suite, uint64_t seed) {
+    // Player::autoSetShips on a batch of reset players.
+    suite.add("player_auto_set_ships", 50000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        array<Player*, BATCH> players;
+        for (Player*& player : players)
+            player = new Player(CPU);
+        long done = 0;
+        while (done < ops) {
+            int batch = static_cast<int>(min<long>(BATCH, ops - done));
+            for (int i = 0; i < batch; ++i)
+                players[i]->reset();
+            watch.start();
+            for (int i = 0; i < batch; ++i)
+                players[i]->autoSetShips(rand_func);
+            watch.stop();
+            done += batch;
+        }
+        for (Player* player : players)
+            delete player;
+    });
+
+    // The placement path used before the generator: ship by ship, retrying random starts on the grid.
+    suite.add("player_auto_set_ship_retries", 20000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        array<Player*, BATCH> players;
+        for (Player*& player : players)
+            player = new Player(CPU);
+        long done = 0;
+        while (done < ops) {
+            int batch = static_cast<int>(min<long>(BATCH, ops - done));
+            for (int i = 0; i < batch; ++i)
+                players[i]->reset();
+            watch.start();
+            for (int i = 0; i < batch; ++i)
+                for (char ship_char : {'A', 'B', 'D', 'S', 'C'})
+                    players[i]->autoSetShip(ship_char, rand_func);
+            watch.stop();
+            done += batch;
+        }
+        for (Player* player : players)
+            delete player;
+    });
+
+    // The generator alone, for callers that only need the masks.
+    suite.add("fleet_generator_sequential", 200000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        watch.start();
+        for (long i = 0; i < ops; ++i)
+            BenchmarkSuite::keep(FleetGenerator::generate(rand_func, SEQUENTIAL).occupancy);
+        watch.stop();
+    });
+    suite.add("fleet_generator_uniform", 200000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        watch.start();
+        for (long i = 0; i < ops; ++i)
+            BenchmarkSuite::keep(FleetGenerator::generate(rand_func, UNIFORM).occupancy);
+        watch.stop();
+    });
+
+    // FleetPerft on one thread, with the carrier and battleship laid: about a million fleets per op.
+    suite.add("fleet_perft_partial", 200, [](long ops, Stopwatch& watch) {
+        PerftBoard board = FleetPerft::parse({"carrier:A1E", "battleship:A3E"});
+        watch.start();
+        for (long i = 0; i < ops; ++i)
+            BenchmarkSuite::keep(FleetPerft::count(board).arrangements);
+        watch.stop();
+    });
+}
+
+// Function to play a fresh headless game until it is the CPU's turn and the CPU has
+// fired at least cpu_shots shots. Returns false if the game ended first.
+bool play_until(Game& game, int cpu_shots, Random& rand_func) {
+    game.reset();
+    game.doSetUp(rand_func);
+    game.doCoinToss(rand_func);
+    game.doFinalSetup();
+    while (!game.someoneHasWon()) {
+        if (game.getTurn() == CPU && game.getCpu()->getNumShots() >= cpu_shots)
+            return true;
+        game.doTurn(rand_func);
+    }
+    return false;
+}
+
+// Function to add Camden::makeMove for one strategy at one stage: a batch of games is
+// played up to the stage untimed, then Camden picks one move in each.
+void add_camden_case(BenchmarkSuite& suite, string name, CamdenType camden_type, int cpu_shots, long ops, uint64_t seed) {
+    suite.add(name, ops, [=](long num_ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        array<Game*, BATCH> games;
+        for (Game*& game : games)
+            game = new Game(EASY, camden_type);
+        long done = 0;
+        while (done < num_ops) {
+            int batch = static_cast<int>(min<long>(BATCH, num_ops - done));
+            for (int i = 0; i < batch; ++i)
+                while (!play_until(*games[i], cpu_shots, rand_func)) {} // Deal again if the game ended too soon.
+            watch.start();
+            for (int i = 0; i < batch; ++i)
+                BenchmarkSuite::keep(games[i]->getCamden()->makeMove(rand_func));
+            watch.stop();
+            done += batch;
+        }
+        for (Game* game : games)
+            delete game;
+    });
+}
+
+// Function to add Camden::makeMove at the first shot, after 20 shots and after 35 shots,
+// and one ROLLOUT move at the default budget after 20 shots.
+void add_camden_cases(BenchmarkSuite& suite, uint64_t seed) {
+    add_camden_case(suite, "camden_easy_move_early", EASY, 0, 20000, seed);
+    add_camden_case(suite, "camden_easy_move_mid", EASY, 20, 5000, seed);
+    add_camden_case(suite, "camden_easy_move_late", EASY, 35, 3000, seed);
+    add_camden_case(suite, "camden_hard_move_early", HARD, 0, 5000, seed);
+    add_camden_case(suite, "camden_hard_move_mid", HARD, 20, 2000, seed);
+    add_camden_case(suite, "camden_hard_move_late", HARD, 35, 1000, seed);
+    add_camden_case(suite, "camden_rollout_move_mid", ROLLOUT, 20, 20, seed);
+}
+
+// Function to add whole headless games, replayed on one reused Game as the simulators do.
+void add_game_cases(BenchmarkSuite& suite, uint64_t seed) {
+    struct Matchup {
+        const char* name;
+        CamdenType rival_type;
+        CamdenType camden_type;
+        long ops;
+    };
+    for (Matchup matchup : {Matchup{"headless_game_easy_easy", EASY, EASY, 3000},
+                            Matchup{"headless_game_hard_hard", HARD, HARD, 300}}) {
+        suite.add(matchup.name, matchup.ops, [=](long ops, Stopwatch& watch) {
+            Simulation simulation(matchup.rival_type, matchup.camden_type);
+            Arena arena;
+            Game* game = simulation.makeGame(&arena);
+            SimulationStats stats;
+            watch.start();
+            for (long i = 0; i < ops; ++i)
+                simulation.playGame(Random::mix(seed, static_cast<uint64_t>(i)), stats, *game);
+            watch.stop();
+            BenchmarkSuite::keep(stats.totalShots);
+            Arena::destroy(&arena, game);
+        });
+    }
+}
+
+// Function to add the GameState cases: snapshots of a game in progress, clones of a
+// state, and blind random playouts on clones, as a rollout AI would run them.
+void add_state_cases(BenchmarkSuite& suite, uint64_t seed) {
+    // GameState::fromGame: a batch of games played to 20 CPU shots, each read into a state.
+    suite.add("game_state_from_game", 20000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        array<Game*, BATCH> games;
+        for (Game*& game : games)
+            game = new Game(EASY, EASY);
+        long done = 0;
+        while (done < ops) {
+            int batch = static_cast<int>(min<long>(BATCH, ops - done));
+            for (int i = 0; i < batch; ++i)
+                while (!play_until(*games[i], 20, rand_func)) {}
+            watch.start();
+            for (int i = 0; i < batch; ++i)
+                BenchmarkSuite::keep(GameState::fromGame(*games[i]));
+            watch.stop();
+            done += batch;
+        }
+        for (Game* game : games)
+            delete game;
+    });
+
+    // Copying a state into a ring of slots.
+    suite.add("game_state_clone", 10000000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        GameState state = GameState::fromFleets(FleetGenerator::generate(rand_func), FleetGenerator::generate(rand_func), MAN);
+        array<GameState, BATCH> clones;
+        watch.start();
+        for (long i = 0; i < ops; ++i) {
+            clones[i % BATCH] = state;
+            BenchmarkSuite::keep(clones[i % BATCH]);
+        }
+        watch.stop();
+    });
+
+    // A clone of a fresh state played out to the end with blind random shots on both sides.
+    suite.add("game_state_random_playout", 20000, [seed](long ops, Stopwatch& watch) {
+        Random rand_func(seed);
+        GameState start = GameState::fromFleets(FleetGenerator::generate(rand_func), FleetGenerator::generate(rand_func), MAN);
+        watch.start();
+        for (long i = 0; i < ops; ++i) {
+            GameState state = start;
+            while (!state.isOver()) {
+                Bitboard open = ~state.shots[GameState::foeOf(state.getTurn())];
+                state.fire(static_cast<SpaceName>(open.select(rand_func.below(open.count())) + 1));
+            }
+            BenchmarkSuite::keep(state.winner());
+        }
+        watch.stop();
+    });
+}
@@ -1,11 +1,11 @@
 #include "Game.h" // Include Game header file.
+#include "Random.h" // Include the random number engine.
 #include <iostream> // Include for input-output operations.
     using std::cin; // Use cin for console input.
     using std::cout; // Use cout for console output.
     using std::endl; // Use endl for line breaks.
 #include <string> // Include for handling strings.
     using std::string; // Use string from the standard namespace.
-#include <cstdlib> // Include for rand and srand functions.
 #include <ctime> // Include for time function to seed random number generator.
 
 // Function prototype to set the player's name.
@@ -13,12 +13,12 @@ void set_name(string& name);
 
 // Main function: Entry point of the program.
 int main() {
-    srand(static_cast<unsigned int>(time(0))); // Seed the random number generator with the current time.
+    Random rand_func(static_cast<uint64_t>(time(0))); // Seed the random number generator with the current time.
     string name; // Variable to store the player's name.
     set_name(name); // Call function to set the player's name.
     
-    // Create a new game instance and pass the player's name and the rand function pointer.
-    Game* game = new Game(name, &rand);
+    // Create a new game instance and pass the player's name and the random number generator.
+    Game* game = new Game(name, rand_func);
     
     // Clean up by deleting the game instance.
     delete game;
@@ -0,0 +1,63 @@
+#include "FleetPerft.h" // Include the fleet tree walk.
+#include "ThreadPool.h" // Include the workers that share the subtrees.
+#include "Enums.h" // Include for ship lengths and space strings.
+#include <iostream> // Include for input-output operations.
+    using std::cout; // Use cout for console output.
+    using std::cerr; // Use cerr for error output.
+    using std::endl; // Use endl for line breaks.
+#include <string> // Include for handling strings.
+    using std::string; // Use string from the standard namespace.
+#include <vector> // Include for the board tokens.
+    using std::vector; // Use vector from the standard namespace.
+#include <cstdlib> // Include for strtol.
+#include <cstdint> // Include for the 64-bit counts.
+#include <stdexcept> // Include for catching bad boards.
+
+// Legal arrangements of the whole fleet on an empty board.
+const uint64_t EMPTY_BOARD_ARRANGEMENTS = 5797542752ULL;
+
+// Entry point for counting every legal fleet.
+// Usage: perft [threads] [divide] [ship:space+direction | miss:space ...]
+// Counts the ways to lay the ships not given on the command line, keeping clear of
+// the ones given, their halos and the misses, and prints nodes per second. With
+// divide, also prints the count under each placement of the longest ship left.
+// Threads default to one per hardware thread. Exit status: 0 on success, 1 for bad
+// arguments, 2 if the empty board does not give EMPTY_BOARD_ARRANGEMENTS.
+int main(int argc, char* argv[]) {
+    long num_threads = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 0; // 0 picks the hardware thread count.
+    bool show_divide = argc > 2 && string(argv[2]) == "divide"; // Break the count down by the first ship.
+    vector<string> tokens(argv + (show_divide ? 3 : 2 < argc ? 2 : argc), argv + argc); // Ships laid and misses.
+
+    PerftBoard board;
+    try {
+        board = FleetPerft::parse(tokens);
+    } catch (std::invalid_argument& e) {
+        cerr << e.what() << endl;
+        cerr << "Usage: perft [threads] [divide] [ship:space+direction | miss:space ...]" << endl;
+        return 1;
+    }
+    if (!FleetPerft::isLegal(board)) {
+        cerr << "The laid ships break the placement rules." << endl;
+        return 1;
+    }
+
+    ThreadPool pool(num_threads > 0 ? static_cast<size_t>(num_threads) : 0);
+    if (show_divide) {
+        for (const auto& [placement, arrangements] : FleetPerft::divide(board, &pool))
+            cout << Spaces::viewFromName(placement.start) << placement.direction() << ": " << arrangements << endl;
+        cout << endl;
+    }
+    PerftResult result = FleetPerft::count(board, &pool);
+    cout << "Arrangements:       " << result.arrangements << endl;
+    cout << "Nodes:              " << result.nodes << endl;
+    cout << "Subtrees:           " << result.tasks << endl;
+    cout << "Threads:            " << pool.size() << endl;
+    cout << "Seconds:            " << result.seconds << endl;
+    cout << "Nodes per second:   " << result.nodesPerSecond() << endl;
+
+    if (tokens.empty() && result.arrangements != EMPTY_BOARD_ARRANGEMENTS) {
+        cerr << "Expected " << EMPTY_BOARD_ARRANGEMENTS << " arrangements on the empty board." << endl;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include "FleetSampler.h" // Include the observation-consistent fleet chain.
+#include "FleetGenerator.h" // Include fleets to observe and to reject.
+#include "Heatmap.h" // Include the placements and the shooter's policy.
+#include "RolloutSearch.h" // Include the observations.
+#include "ReplayAnalytics.h" // Include the heatmap printer.
+#include "FleetCounter.h" // Include the exact counts for uniform fleets.
+#include "ThreadPool.h" // Include workers for the exact counts.
+#include "Random.h" // Include the seeded engine.
+#include <iostream> // Include for input-output operations.
+    using std::cout; // Use cout for console output.
+    using std::cerr; // Use cerr for error output.
+    using std::endl; // Use endl for line breaks.
+#include <string> // Include for handling strings.
+    using std::string; // Use string from the standard namespace.
+#include <array> // Include for the occupancy counts.
+    using std::array; // Use array from the standard namespace.
+#include <cstdlib> // Include for strtol and strtoull.
+#include <cstdint> // Include for the 64-bit seed.
+#include <ctime> // Include for time function to seed random number generator.
+#include <chrono> // Include for timing rejection sampling.
+#include <stdexcept> // Include for catching a state no fleet fits.
+#include <algorithm> // Include for max.
+#include <cmath> // Include for abs.
+
+// Entry point for drawing fleets that agree with a game in progress.
+// Usage: sampler [shots] [samples] [seed] [thin] [target]
+// Deals a fleet, fires shots at it as a hard Camden would (30 by default), then
+// runs FleetSampler for samples fleets (100000 by default), one every thin sweeps
+// (1 by default), from the sequential or uniform fleet distribution. Prints where
+// the sampled ships lay, samples per second and the effective sample size, then
+// gives rejection sampling from FleetGenerator the same time for comparison. For
+// uniform fleets, also counts every fitting arrangement with FleetCounter and
+// reports how far the chain is from the exact heatmap.
+int main(int argc, char* argv[]) {
+    long num_shots = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 30; // Shots fired before sampling.
+    long num_samples = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 100000; // Fleets read off the chain.
+    uint64_t seed = argc > 3 ? static_cast<uint64_t>(std::strtoull(argv[3], nullptr, 10)) : static_cast<uint64_t>(time(0));
+    long thin = argc > 4 ? std::strtol(argv[4], nullptr, 10) : 1; // Sweeps between samples.
+    string target = argc > 5 ? argv[5] : "sequential"; // Fleet distribution to sample.
+    if ((target != "sequential" && target != "uniform") || num_samples < 1 || thin < 1) {
+        cerr << "Usage: sampler [shots] [samples] [seed] [thin] [sequential|uniform]" << endl;
+        return 1;
+    }
+    FleetMode fleet_mode = target == "uniform" ? UNIFORM : SEQUENTIAL;
+
+    // Deal a fleet and fire at it with the heatmap, as HARD does.
+    Random rand_func(seed);
+    Fleet fleet = FleetGenerator::generate(rand_func);
+    Heatmap heatmap;
+    Bitboard shots;
+    RolloutSearch::Observation observation = FleetSampler::observe(fleet, shots);
+    for (long shot = 0; shot < num_shots && observation.numAfloat > 0; ++shot) {
+        heatmap.observe(observation.hits, (shots & ~observation.hits) | observation.sunk.spread());
+        SpaceName space = heatmap.bestSpace(View<ShipType>(observation.afloat.data(), static_cast<size_t>(observation.numAfloat)), observation.hits & ~observation.sunk, shots, rand_func);
+        shots.set(static_cast<int>(space) - 1);
+        observation = FleetSampler::observe(fleet, shots);
+    }
+    heatmap.observe(observation.hits, (shots & ~observation.hits) | observation.sunk.spread());
+    cout << "Seed " << seed << ", " << shots.count() << " shots, " << observation.hits.count() << " hits, "
+         << 5 - observation.numAfloat << " ships sunk, " << target << " fleets" << endl << endl;
+
+    array<long, 100> occupancy {};
+    FleetSampler::Stats stats;
+    try {
+        FleetSampler sampler(heatmap, observation, fleet_mode);
+        stats = sampler.run(num_samples, static_cast<int>(thin), 100, rand_func, occupancy);
+    } catch (std::runtime_error& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    ReplayAnalytics::printHeatmap(cout, "Afloat ships (% of samples a space held one)", occupancy, stats.samples);
+    cout << "Samples:            " << stats.samples << endl;
+    cout << "Moves:              " << stats.steps << endl;
+    cout << "Moves that moved:   " << stats.moved << endl;
+    cout << "Seconds:            " << stats.seconds << endl;
+    cout << "Samples per second: " << stats.samplesPerSecond() << endl;
+    cout << "Effective samples:  " << stats.effectiveSamples << endl;
+    cout << "Effective per sec:  " << (stats.seconds > 0.0 ? stats.effectiveSamples / stats.seconds : 0.0) << endl << endl;
+
+    // Rejection sampling: deal whole fleets and keep those that agree with the shots.
+    long tries = 0;
+    long kept = 0;
+    array<long, 100> kept_occupancy {};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    double seconds = 0.0;
+    while (seconds < stats.seconds) {
+        for (int i = 0; i < 1000; ++i) {
+            ++tries;
+            Fleet dealt = FleetGenerator::generate(rand_func, fleet_mode);
+            bool same_sunk = true;
+            for (int ship_type = CARRIER; ship_type <= CRUISER; ++ship_type)
+                if ((observation.sunkShips[ship_type].any() && dealt.ships[ship_type].mask != observation.sunkShips[ship_type]) ||
+                    (observation.sunkShips[ship_type].none() && (dealt.ships[ship_type].mask & ~shots).none()))
+                    same_sunk = false;
+            array<Bitboard, 5> afloat_ships {};
+            for (int k = 0; k < observation.numAfloat; ++k)
+                afloat_ships[k] = dealt.ships[observation.afloat[k]].mask;
+            if (!same_sunk || !FleetSampler::fits(observation, afloat_ships))
+                continue;
+            ++kept;
+            for (int k = 0; k < observation.numAfloat; ++k) {
+                Bitboard spaces = afloat_ships[k];
+                while (spaces.any())
+                    ++kept_occupancy[spaces.popLowest()];
+            }
+        }
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    cout << "Rejection tries:    " << tries << endl;
+    cout << "Rejection kept:     " << kept << endl;
+    cout << "Kept per second:    " << (seconds > 0.0 ? static_cast<double>(kept) / seconds : 0.0) << endl;
+    if (kept > 0) {
+        double largest_gap = 0.0; // Percentage points between the two estimates, at the worst space.
+        for (int i = 0; i < 100; ++i)
+            largest_gap = std::max(largest_gap, std::abs(100.0 * static_cast<double>(occupancy[i]) / static_cast<double>(stats.samples) - 100.0 * static_cast<double>(kept_occupancy[i]) / static_cast<double>(kept)));
+        cout << "Largest gap (pts):  " << largest_gap << endl;
+    }
+
+    // Exact counts, which weigh every arrangement the same as the uniform chain does.
+    if (fleet_mode == UNIFORM) {
+        ThreadPool pool;
+        start = std::chrono::steady_clock::now();
+        FleetCounts exact = FleetCounter::occupancy(observation, &pool);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double largest_gap = 0.0; // Percentage points between the chain and the exact heatmap.
+        for (int i = 0; i < 100; ++i)
+            largest_gap = std::max(largest_gap, std::abs(100.0 * static_cast<double>(occupancy[i]) / static_cast<double>(stats.samples) - 100.0 * exact.probability(i)));
+        cout << endl;
+        cout << "Exact fleets:       " << exact.total << endl;
+        cout << "Exact seconds:      " << seconds << endl;
+        cout << "Chain gap (pts):    " << largest_gap << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "Simulation.h" // Include the headless batch runner.
+#include "Tournament.h" // Include the multithreaded batch runner.
+#include "ReplayWriter.h" // Include the replay file writer.
+#include "PlacementPrior.h" // Include Camden's optional hunting weights.
+#include "HeatmapCache.h" // Include the optional weights shared by every worker.
+#include <iostream> // Include for input-output operations.
+    using std::cout; // Use cout for console output.
+    using std::cerr; // Use cerr for error output.
+    using std::endl; // Use endl for line breaks.
+#include <string> // Include for handling strings.
+    using std::string; // Use string from the standard namespace.
+#include <cstdlib> // Include for strtol and strtoull.
+#include <cstdint> // Include for the 64-bit seed.
+#include <ctime> // Include for time function to seed random number generator.
+#include <stdexcept> // Include for catching bad arguments.
+#include <memory> // Include for the optional replay writer.
+
+// Entry point for headless CPU-vs-CPU batches.
+// Usage: simulate [games] [rival strategy] [camden strategy] [seed] [threads] [replay file] [prior file] [cache MB]
+// Strategies are random, easy, hard or rollout. Defaults: 1000 easy easy, seeded from the clock,
+// one thread per hardware thread. A given seed gives the same totals for any thread count.
+// With a replay file, every game is appended to it ("-" for none). A prior file written
+// by analyze weights where a hard Camden hunts ("-" for none). With cache MB above 0,
+// hard seats share that much cached heatmap weights across the threads; the totals
+// are the same with or without it.
+int main(int argc, char* argv[]) {
+    long num_games = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 1000; // Number of games to play.
+    CamdenType rival_type = EASY; // Strategy in the human's seat.
+    CamdenType camden_type = EASY; // Strategy in the CPU's seat.
+    try {
+        if (argc > 2) rival_type = Simulation::typeFromString(argv[2]);
+        if (argc > 3) camden_type = Simulation::typeFromString(argv[3]);
+    } catch (std::invalid_argument& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    uint64_t seed = argc > 4 ? static_cast<uint64_t>(std::strtoull(argv[4], nullptr, 10)) : static_cast<uint64_t>(time(0));
+    long num_threads = argc > 5 ? std::strtol(argv[5], nullptr, 10) : 0; // 0 picks the hardware thread count.
+
+    Tournament tournament(rival_type, camden_type, num_threads > 0 ? static_cast<size_t>(num_threads) : 0);
+    std::unique_ptr<ReplayWriter> replay_writer; // Kept until the batch is done, then flushed by its destructor.
+    if (argc > 6 && string(argv[6]) != "-") {
+        try {
+            replay_writer.reset(new ReplayWriter(argv[6]));
+        } catch (std::runtime_error& e) {
+            cerr << e.what() << endl;
+            return 1;
+        }
+        tournament.setReplayWriter(replay_writer.get());
+    }
+    PlacementPrior camden_prior; // Shared read-only by every game of the batch.
+    if (argc > 7 && string(argv[7]) != "-") {
+        try {
+            camden_prior = PlacementPrior::load(argv[7]);
+        } catch (std::runtime_error& e) {
+            cerr << e.what() << endl;
+            return 1;
+        }
+        tournament.setCamdenPrior(&camden_prior);
+    }
+    long cache_megabytes = argc > 8 ? std::strtol(argv[8], nullptr, 10) : 0; // 0 for no cache.
+    std::unique_ptr<HeatmapCache> heatmap_cache; // Outlives the batch so its counters can be read.
+    if (cache_megabytes > 0) {
+        heatmap_cache.reset(new HeatmapCache(static_cast<size_t>(cache_megabytes) << 20));
+        tournament.setHeatmapCache(heatmap_cache.get());
+    }
+    cout << Simulation::stringFromType(rival_type) << " vs " << Simulation::stringFromType(camden_type)
+         << ", seed " << seed << ", " << tournament.getThreads() << " threads" << endl;
+    Simulation::printStats(tournament.run(num_games, seed));
+    if (replay_writer) {
+        replay_writer->flush();
+        cout << "Replays written:    " << replay_writer->getNumRecords() << " to " << argv[6] << endl;
+    }
+    if (heatmap_cache) {
+        HeatmapCache::Stats cache_stats = heatmap_cache->getStats();
+        cout << "Cache lookups:      " << cache_stats.lookups << endl;
+        cout << "Cache hit rate:     " << 100.0 * cache_stats.hitRate() << "%" << endl;
+        cout << "Cache entries:      " << cache_stats.entries << " of " << cache_stats.capacity << endl;
+        cout << "Cache evictions:    " << cache_stats.evictions << endl;
+        cout << "Cache memory (MB):  " << static_cast<double>(cache_stats.bytes) / (1 << 20) << endl;
+    }
+    return 0;
+}